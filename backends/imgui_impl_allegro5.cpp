@@ -50,6 +50,11 @@
 #include "imgui.h"
 #ifndef IMGUI_DISABLE
 #include "imgui_impl_allegro5.h"
+
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+#error IMGUI_USE_COMPACT_DRAWVERT is not supported by this backend, which reads ImDrawVert positions and UV as 32-bit floats.
+#endif
+
 #include <stdint.h>     // uint64_t
 #include <cstring>      // memcpy
 
@@ -231,7 +236,7 @@ bool ImGui_ImplAllegro5_CreateDeviceObjects()
     io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
 
     // Create texture
-    // (Bilinear sampling is required by default. Set 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines' or 'style.AntiAliasedLinesUseTex = false' to allow point/nearest sampling)
+    // (Bilinear sampling is required by default. Set 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_NoBakedRoundCorners' or 'style.AntiAliasedLinesUseTex = style.AntiAliasedFillUseTex = false' to allow point/nearest sampling)
     int flags = al_get_new_bitmap_flags();
     int fmt = al_get_new_bitmap_format();
     al_set_new_bitmap_flags(ALLEGRO_MEMORY_BITMAP | ALLEGRO_MIN_LINEAR | ALLEGRO_MAG_LINEAR);
@@ -34,6 +34,10 @@
 #ifndef IMGUI_DISABLE
 #include "imgui_impl_dx11.h"
 
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+#error IMGUI_USE_COMPACT_DRAWVERT is not supported by this backend, which reads ImDrawVert positions and UV as 32-bit floats.
+#endif
+
 // DirectX
 #include <stdio.h>
 #include <d3d11.h>
@@ -351,7 +355,7 @@ static void ImGui_ImplDX11_CreateFontsTexture()
     io.Fonts->SetTexID((ImTextureID)bd->pFontTextureView);
 
     // Create texture sampler
-    // (Bilinear sampling is required by default. Set 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines' or 'style.AntiAliasedLinesUseTex = false' to allow point/nearest sampling)
+    // (Bilinear sampling is required by default. Set 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_NoBakedRoundCorners' or 'style.AntiAliasedLinesUseTex = style.AntiAliasedFillUseTex = false' to allow point/nearest sampling)
     {
         D3D11_SAMPLER_DESC desc;
         ZeroMemory(&desc, sizeof(desc));
@@ -42,6 +42,10 @@
 #ifndef IMGUI_DISABLE
 #include "imgui_impl_dx12.h"
 
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+#error IMGUI_USE_COMPACT_DRAWVERT is not supported by this backend, which reads ImDrawVert positions and UV as 32-bit floats.
+#endif
+
 // DirectX
 #include <d3d12.h>
 #include <dxgi1_4.h>
@@ -471,7 +475,7 @@ bool    ImGui_ImplDX12_CreateDeviceObjects()
         param[1].DescriptorTable.pDescriptorRanges = &descRange;
         param[1].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
 
-        // Bilinear sampling is required by default. Set 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines' or 'style.AntiAliasedLinesUseTex = false' to allow point/nearest sampling.
+        // Bilinear sampling is required by default. Set 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_NoBakedRoundCorners' or 'style.AntiAliasedLinesUseTex = style.AntiAliasedFillUseTex = false' to allow point/nearest sampling.
         D3D12_STATIC_SAMPLER_DESC staticSampler = {};
         staticSampler.Filter = D3D12_FILTER_MIN_MAG_MIP_LINEAR;
         staticSampler.AddressU = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
@@ -35,6 +35,10 @@
 #ifndef IMGUI_DISABLE
 #include "imgui_impl_dx9.h"
 
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+#error IMGUI_USE_COMPACT_DRAWVERT is not supported by this backend, which reads ImDrawVert positions and UV as 32-bit floats.
+#endif
+
 // DirectX
 #include <d3d9.h>
 
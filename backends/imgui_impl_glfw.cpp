@@ -17,6 +17,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-16: Added ImGui_ImplGlfw_WaitForEvents() to wait for events until io.NextFrameDeadline, reducing CPU usage while idle.
 //  2023-07-18: Inputs: Revert ignoring mouse data on GLFW_CURSOR_DISABLED as it can be used differently. User may set ImGuiConfigFLags_NoMouse if desired. (#5625, #6609)
 //  2023-06-12: Accept glfwGetTime() not returning a monotonically increasing value. This seems to happens on some Windows setup when peripherals disconnect, and is likely to also happen on browser + Emscripten. (#6491)
 //  2023-04-04: Inputs: Added support for io.AddMouseSourceEvent() to discriminate ImGuiMouseSource_Mouse/ImGuiMouseSource_TouchScreen/ImGuiMouseSource_Pen on Windows ONLY, using a custom WndProc hook. (#2702)
@@ -103,6 +104,7 @@
 #define GLFW_HAS_GAMEPAD_API            (GLFW_VERSION_COMBINED >= 3300) // 3.3+ glfwGetGamepadState() new api
 #define GLFW_HAS_GETKEYNAME             (GLFW_VERSION_COMBINED >= 3200) // 3.2+ glfwGetKeyName()
 #define GLFW_HAS_GETERROR               (GLFW_VERSION_COMBINED >= 3300) // 3.3+ glfwGetError()
+#define GLFW_HAS_WAIT_EVENTS_TIMEOUT    (GLFW_VERSION_COMBINED >= 3200) // 3.2+ glfwWaitEventsTimeout()
 
 // GLFW data
 enum GlfwClientApi
@@ -788,6 +790,35 @@ void ImGui_ImplGlfw_NewFrame()
     ImGui_ImplGlfw_UpdateGamepads();
 }
 
+// Wait until an input event is received or Dear ImGui needs a new frame (io.NextFrameDeadline), to reduce CPU/GPU usage while idle.
+// Call from your main loop before glfwPollEvents(), after rendering. Use 'max_timeout' (in seconds) to limit waiting, e.g. for your own animations.
+// GLFW doesn't emit events for gamepads, so we don't wait longer than a frame when gamepad navigation is enabled and a gamepad is connected.
+void ImGui_ImplGlfw_WaitForEvents(double max_timeout)
+{
+#ifndef __EMSCRIPTEN__
+    ImGui_ImplGlfw_Data* bd = ImGui_ImplGlfw_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Did you call ImGui_ImplGlfw_InitForXXX()?");
+    ImGuiIO& io = ImGui::GetIO();
+
+    // io.NextFrameDeadline is expressed in ImGui::GetTime() timeline, which was in sync with bd->Time during the last ImGui_ImplGlfw_NewFrame() call.
+    double timeout = io.NextFrameDeadline - ImGui::GetTime() - (glfwGetTime() - bd->Time);
+    if ((io.ConfigFlags & ImGuiConfigFlags_NavEnableGamepad) && (io.BackendFlags & ImGuiBackendFlags_HasGamepad) && timeout > 1.0 / 60.0)
+        timeout = 1.0 / 60.0;
+    if (timeout > max_timeout)
+        timeout = max_timeout;
+    if (timeout <= 0.0)
+        return;
+    if (timeout >= (double)FLT_MAX)
+        glfwWaitEvents();
+#if GLFW_HAS_WAIT_EVENTS_TIMEOUT
+    else
+        glfwWaitEventsTimeout(timeout);
+#endif
+#else
+    IM_UNUSED(max_timeout);
+#endif
+}
+
 //-----------------------------------------------------------------------------
 
 #if defined(__clang__)
@@ -6,6 +6,11 @@
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID!
 //  [x] Renderer: Large meshes support (64k+ vertices) with 16-bit indices (Desktop OpenGL only).
+//  [x] Renderer: Shape instances (ImGuiBackendFlags_RendererHasShapes) rendered with instancing (Desktop OpenGL 3.3+ and OpenGL ES 3.0 only).
+//  [X] Renderer: Partial font texture updates (ImGuiBackendFlags_RendererHasTexUpdates) for ImFontAtlasFlags_DynamicGlyphs.
+//  [X] Renderer: Multiple font texture pages (ImGuiBackendFlags_RendererHasTexPages) for ImFontAtlas::TexMaxHeight.
+//  [x] Renderer: Signed distance field fonts (ImGuiBackendFlags_RendererHasSDF) for ImFontConfig::SDF (GLSL 1.30+ only).
+//  [x] Renderer: Single channel font textures sampled with a swizzle (Desktop OpenGL 3.3+ and OpenGL ES 3.0 only, not WebGL).
 
 // About WebGL/ES:
 // - You need to '#define IMGUI_IMPL_OPENGL_ES2' or '#define IMGUI_IMPL_OPENGL_ES3' to use WebGL or OpenGL ES.
@@ -19,6 +24,12 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-16: OpenGL: Upload font atlas as a single channel GL_R8 texture with (1,1,1,R) swizzle on GL 3.3+/ES 3.0, saving 75% of texture memory. Honor ImFontAtlasFlags_ClearTexDataAfterUpload.
+//  2026-10-16: OpenGL: Draw ImFontAtlas texture pages flagged as SDF with a distance field shader. Sets ImGuiBackendFlags_RendererHasSDF with GLSL 1.30+.
+//  2026-10-16: OpenGL: Create one texture per ImFontAtlas texture page (see ImFontAtlas::TexMaxHeight). Sets ImGuiBackendFlags_RendererHasTexPages.
+//  2026-10-16: OpenGL: Upload regions listed in ImFontAtlas::TexDirtyRects[] with glTexSubImage2D() at the beginning of ImGui_ImplOpenGL3_RenderDrawData(). Sets ImGuiBackendFlags_RendererHasTexUpdates.
+//  2026-10-16: OpenGL: Added support for ImDrawList shape instances, rendered with an instanced signed distance shader. Sets ImGuiBackendFlags_RendererHasShapes on GL 3.3+ and GL ES 3.0.
+//  2026-10-16: OpenGL: Added support for compact vertex layout enabled with IMGUI_USE_COMPACT_DRAWVERT.
 //  2023-06-20: OpenGL: Fixed erroneous use glGetIntegerv(GL_CONTEXT_PROFILE_MASK) on contexts lower than 3.2. (#6539, #6333)
 //  2023-05-09: OpenGL: Support for glBindSampler() backup/restore on ES3. (#6375)
 //  2023-04-18: OpenGL: Restore front and back polygon mode separately when supported by context. (#6333)
@@ -185,11 +196,21 @@
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
 #endif
 
+// Desktop GL 3.3+ and GL ES 3.0+ have glVertexAttribDivisor() and glDrawArraysInstanced()
+#if !defined(IMGUI_IMPL_OPENGL_ES2) && (defined(IMGUI_IMPL_OPENGL_ES3) || defined(GL_VERSION_3_3))
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+#endif
+
 // Desktop GL 3.1+ has GL_PRIMITIVE_RESTART state
 #if !defined(IMGUI_IMPL_OPENGL_ES2) && !defined(IMGUI_IMPL_OPENGL_ES3) && defined(GL_VERSION_3_1)
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
 #endif
 
+// Desktop GL 3.3+ and GL ES 3.0+ have texture swizzle (WebGL 2.0 doesn't)
+#if !defined(IMGUI_IMPL_OPENGL_ES2) && (defined(IMGUI_IMPL_OPENGL_ES3) || defined(GL_VERSION_3_3)) && !defined(__EMSCRIPTEN__)
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_SWIZZLE
+#endif
+
 // Desktop GL use extension detection
 #if !defined(IMGUI_IMPL_OPENGL_ES2) && !defined(IMGUI_IMPL_OPENGL_ES3)
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_EXTENSIONS
@@ -214,6 +235,9 @@ struct ImGui_ImplOpenGL3_Data
     bool            GlProfileIsCompat;
     GLint           GlProfileMask;
     GLuint          FontTexture;
+    ImVector<GLuint> FontTexturePages;       // Textures of ImFontAtlas pages 1+, see ImFontAtlas::GetTexPageCount()
+    ImVector<GLuint> FontTexturesSDF;        // Subset of FontTexturePages[] drawn with SdfShaderHandle, see ImFontAtlasTexPage::SDF
+    int             FontTextureBytesPerPixel;// 1 = GL_R8 texture sampled as (1,1,1,R), 4 = GL_RGBA texture
     GLuint          ShaderHandle;
     GLint           AttribLocationTex;       // Uniforms location
     GLint           AttribLocationProjMtx;
@@ -221,9 +245,19 @@ struct ImGui_ImplOpenGL3_Data
     GLuint          AttribLocationVtxUV;
     GLuint          AttribLocationVtxColor;
     unsigned int    VboHandle, ElementsHandle;
+    GLuint          ShapeShaderHandle;       // Shape instances program, see ImDrawListFlags_ShapeInstances
+    GLint           AttribLocationShapeProjMtx;
+    GLuint          AttribLocationShapeRect;
+    GLuint          AttribLocationShapeParams;
+    GLuint          AttribLocationShapeColor;
+    unsigned int    ShapeVboHandle;
+    GLuint          SdfShaderHandle;         // Distance field program for ImFontConfig::SDF font pages (same vertex shader as ShaderHandle)
+    GLint           AttribLocationSdfTex;
+    GLint           AttribLocationSdfProjMtx;
     GLsizeiptr      VertexBufferSize;
     GLsizeiptr      IndexBufferSize;
     bool            HasClipOrigin;
+    bool            HasTextureSwizzle;
     bool            UseBufferSubData;
 
     ImGui_ImplOpenGL3_Data() { memset((void*)this, 0, sizeof(*this)); }
@@ -327,6 +361,8 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
     if (bd->GlVersion >= 320)
         io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
 #endif
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTexUpdates;     // We can upload ImFontAtlas::TexDirtyRects[], allowing ImFontAtlasFlags_DynamicGlyphs.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTexPages;       // We can create a texture per ImFontAtlas page, allowing ImFontAtlas::TexMaxHeight.
 
     // Store GLSL version string so we can refer to it later in case we recreate shaders.
     // Note: GLSL version is NOT the same as GL version. Leave this to nullptr if unsure.
@@ -346,6 +382,17 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
     strcpy(bd->GlslVersionString, glsl_version);
     strcat(bd->GlslVersionString, "\n");
 
+    int glsl_version_num = 130;
+    sscanf(bd->GlslVersionString, "#version %d", &glsl_version_num);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+    // Shape instances need instancing + GLSL 1.30 for gl_VertexID
+    if ((bd->GlVersion >= 330 || bd->GlProfileIsES3) && glsl_version_num >= 130)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasShapes;     // We can honor the ImDrawCmd::ShapeCount field, allowing ImDrawListFlags_ShapeInstances.
+#endif
+    // Distance field shader uses fwidth() and 'in'/'out' qualifiers (fwidth() needs an extension on GLSL ES 1.00)
+    if (glsl_version_num >= 130)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasSDF;        // We can draw ImFontAtlas pages flagged as SDF, allowing ImFontConfig::SDF.
+
     // Make an arbitrary GL call (we don't actually need the result)
     // IF YOU GET A CRASH HERE: it probably means the OpenGL function loader didn't do its job. Let us know!
     GLint current_texture;
@@ -353,6 +400,9 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
 
     // Detect extensions we support
     bd->HasClipOrigin = (bd->GlVersion >= 450);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_SWIZZLE
+    bd->HasTextureSwizzle = (bd->GlVersion >= 330 || bd->GlProfileIsES3);
+#endif
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_EXTENSIONS
     GLint num_extensions = 0;
     glGetIntegerv(GL_NUM_EXTENSIONS, &num_extensions);
@@ -376,7 +426,7 @@ void    ImGui_ImplOpenGL3_Shutdown()
     ImGui_ImplOpenGL3_DestroyDeviceObjects();
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasShapes | ImGuiBackendFlags_RendererHasTexUpdates | ImGuiBackendFlags_RendererHasTexPages | ImGuiBackendFlags_RendererHasSDF);
     IM_DELETE(bd);
 }
 
@@ -430,13 +480,28 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
 #if defined(GL_CLIP_ORIGIN)
     if (!clip_origin_lower_left) { float tmp = T; T = B; B = tmp; } // Swap top and bottom if origin is upper left
 #endif
-    const float ortho_projection[4][4] =
+    float ortho_projection[4][4] =
     {
         { 2.0f/(R-L),   0.0f,         0.0f,   0.0f },
         { 0.0f,         2.0f/(T-B),   0.0f,   0.0f },
         { 0.0f,         0.0f,        -1.0f,   0.0f },
         { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
     };
+    if (bd->ShapeShaderHandle)
+    {
+        glUseProgram(bd->ShapeShaderHandle);
+        glUniformMatrix4fv(bd->AttribLocationShapeProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+    }
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    ortho_projection[0][0] /= IM_DRAWVERT_POS_ONE; // Positions are fixed point
+    ortho_projection[1][1] /= IM_DRAWVERT_POS_ONE;
+#endif
+    if (bd->FontTexturesSDF.Size > 0)
+    {
+        glUseProgram(bd->SdfShaderHandle);
+        glUniform1i(bd->AttribLocationSdfTex, 0);
+        glUniformMatrix4fv(bd->AttribLocationSdfProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+    }
     glUseProgram(bd->ShaderHandle);
     glUniform1i(bd->AttribLocationTex, 0);
     glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
@@ -457,11 +522,109 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxPos));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxUV));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxColor));
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_SHORT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos)));
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_UNSIGNED_SHORT,GL_TRUE,  sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv)));
+#else
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos)));
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv)));
+#endif
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, col)));
 }
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+// Render shape instances of a command (after its triangles), then restore state for rendering triangles.
+// Each instance is a quad covering the shape + anti-aliasing fringe, the fragment shader evaluates coverage from the signed distance to the shape.
+static void ImGui_ImplOpenGL3_RenderShapes(const ImDrawCmd* pcmd, GLuint shape_vertex_array_object, GLuint vertex_array_object)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    const size_t shape_offset = pcmd->ShapeOffset * sizeof(ImDrawShape); // Specify offset with attribute pointers as glDrawArraysInstancedBaseInstance() is GL 4.2+
+    glUseProgram(bd->ShapeShaderHandle);
+    glBindVertexArray(shape_vertex_array_object);
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->ShapeVboHandle));
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationShapeRect,   4, GL_FLOAT,         GL_FALSE, sizeof(ImDrawShape), (GLvoid*)(shape_offset + IM_OFFSETOF(ImDrawShape, Min))));
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationShapeParams, 2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawShape), (GLvoid*)(shape_offset + IM_OFFSETOF(ImDrawShape, Rounding))));
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationShapeColor,  4, GL_UNSIGNED_BYTE, GL_TRUE,  sizeof(ImDrawShape), (GLvoid*)(shape_offset + IM_OFFSETOF(ImDrawShape, Col))));
+    GL_CALL(glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, (GLsizei)pcmd->ShapeCount));
+    glUseProgram(bd->ShaderHandle);
+    glBindVertexArray(vertex_array_object);
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->VboHandle));
+}
+#endif
+
+// Pixel format of font textures: GL_RED for single channel textures, see ImGui_ImplOpenGL3_CreateFontTexturePage()
+static GLenum ImGui_ImplOpenGL3_GetFontTextureFormat(int bytes_per_pixel)
+{
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_SWIZZLE
+    if (bytes_per_pixel == 1)
+        return GL_RED;
+#endif
+    IM_ASSERT(bytes_per_pixel == 4);
+    return GL_RGBA;
+}
+
+// Create a texture from atlas pixels. Single channel textures are sampled as (1,1,1,R), which our shaders (and user shaders) read the same way as white RGBA32 pixels.
+// Caller is in charge of backing up/restoring the texture binding and setting GL_UNPACK_ALIGNMENT.
+static void ImGui_ImplOpenGL3_CreateFontTexturePage(GLuint texture, const unsigned char* pixels, int width, int height, int bytes_per_pixel)
+{
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, texture));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_SWIZZLE
+    if (bytes_per_pixel == 1)
+    {
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_R, GL_ONE));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_G, GL_ONE));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_B, GL_ONE));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_A, GL_RED));
+        GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, width, height, 0, GL_RED, GL_UNSIGNED_BYTE, pixels));
+        return;
+    }
+#endif
+    IM_ASSERT(bytes_per_pixel == 4);
+    GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+}
+
+// Upload regions of the atlas modified since the texture was created or last updated.
+// Caller is in charge of backing up/restoring the texture binding.
+static void ImGui_ImplOpenGL3_UpdateFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+
+    // Use the same format as the texture
+    unsigned char* pixels;
+    int width, height;
+    const int bpp = bd->FontTextureBytesPerPixel;
+    if (bpp == 1)
+        io.Fonts->GetTexDataAsAlpha8(&pixels, &width, &height);
+    else
+        io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    const GLenum format = ImGui_ImplOpenGL3_GetFontTextureFormat(bpp);
+    GLint last_unpack_alignment;
+    GL_CALL(glGetIntegerv(GL_UNPACK_ALIGNMENT, &last_unpack_alignment));
+    GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, bd->FontTexture));
+#ifdef GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
+    GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, width));
+#endif
+    for (int n = 0; n < io.Fonts->TexDirtyRects.Size; n++)
+    {
+        const ImFontAtlasDirtyRect& r = io.Fonts->TexDirtyRects[n];
+#ifdef GL_UNPACK_ROW_LENGTH
+        GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, r.X, r.Y, r.Width, r.Height, format, GL_UNSIGNED_BYTE, pixels + ((size_t)r.Y * width + r.X) * bpp));
+#else
+        // Without GL_UNPACK_ROW_LENGTH we upload full rows
+        GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, r.Y, width, r.Height, format, GL_UNSIGNED_BYTE, pixels + (size_t)r.Y * width * bpp));
+#endif
+    }
+#ifdef GL_UNPACK_ROW_LENGTH
+    GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+#endif
+    GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, last_unpack_alignment));
+    io.Fonts->TexDirtyRects.resize(0);
+}
+
 // OpenGL3 Render function.
 // Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state explicitly.
 // This is in order to be able to run within an OpenGL engine that doesn't do so.
@@ -514,14 +677,33 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     GLboolean last_enable_primitive_restart = (bd->GlVersion >= 310) ? glIsEnabled(GL_PRIMITIVE_RESTART) : GL_FALSE;
 #endif
 
+    // Upload glyphs rasterized since last frame (ImFontAtlasFlags_DynamicGlyphs)
+    if (bd->FontTexture != 0 && ImGui::GetIO().Fonts->TexDirtyRects.Size > 0)
+        ImGui_ImplOpenGL3_UpdateFontsTexture();
+
     // Setup desired GL state
     // Recreate the VAO every time (this is to easily allow multiple GL contexts to be rendered to. VAO are not shared among GL contexts)
     // The renderer would actually work without any VAO bound, but then our VertexAttrib calls would overwrite the default one currently bound.
     GLuint vertex_array_object = 0;
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
     GL_CALL(glGenVertexArrays(1, &vertex_array_object));
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+    GLuint shape_vertex_array_object = 0;
+    if (draw_data->TotalShapeCount > 0 && bd->ShapeShaderHandle)
+    {
+        GL_CALL(glGenVertexArrays(1, &shape_vertex_array_object));
+        GL_CALL(glBindVertexArray(shape_vertex_array_object));
+        const GLuint shape_attribs[] = { bd->AttribLocationShapeRect, bd->AttribLocationShapeParams, bd->AttribLocationShapeColor };
+        for (GLuint attrib : shape_attribs)
+        {
+            GL_CALL(glEnableVertexAttribArray(attrib));
+            GL_CALL(glVertexAttribDivisor(attrib, 1));
+        }
+    }
 #endif
     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+    GLuint current_program = bd->ShaderHandle; // Only switch programs when the atlas has SDF pages
 
     // Will project scissor/clipping rectangles into framebuffer space
     ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
@@ -562,6 +744,14 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
             GL_CALL(glBufferData(GL_ARRAY_BUFFER, vtx_buffer_size, (const GLvoid*)cmd_list->VtxBuffer.Data, GL_STREAM_DRAW));
             GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_buffer_size, (const GLvoid*)cmd_list->IdxBuffer.Data, GL_STREAM_DRAW));
         }
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+        if (cmd_list->ShapeBuffer.Size > 0 && shape_vertex_array_object != 0)
+        {
+            GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->ShapeVboHandle));
+            GL_CALL(glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)cmd_list->ShapeBuffer.Size * (int)sizeof(ImDrawShape), (const GLvoid*)cmd_list->ShapeBuffer.Data, GL_STREAM_DRAW));
+            GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->VboHandle));
+        }
+#endif
 
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
         {
@@ -574,6 +764,7 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
                 else
                     pcmd->UserCallback(cmd_list, pcmd);
+                current_program = bd->ShaderHandle;
             }
             else
             {
@@ -586,14 +777,31 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
                 GL_CALL(glScissor((int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y)));
 
-                // Bind texture, Draw
-                GL_CALL(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID()));
+                // Bind texture and matching program, Draw
+                const GLuint texture = (GLuint)(intptr_t)pcmd->GetTexID();
+                GL_CALL(glBindTexture(GL_TEXTURE_2D, texture));
+                if (bd->FontTexturesSDF.Size > 0)
+                {
+                    const GLuint program = bd->FontTexturesSDF.contains(texture) ? bd->SdfShaderHandle : bd->ShaderHandle;
+                    if (program != current_program)
+                        glUseProgram(program);
+                    current_program = program;
+                }
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
                 if (bd->GlVersion >= 320)
                     GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset));
                 else
 #endif
                 GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx))));
+
+                // Draw shape instances
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+                if (pcmd->ShapeCount > 0 && shape_vertex_array_object != 0)
+                {
+                    ImGui_ImplOpenGL3_RenderShapes(pcmd, shape_vertex_array_object, vertex_array_object);
+                    current_program = bd->ShaderHandle;
+                }
+#endif
             }
         }
     }
@@ -602,6 +810,10 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
     GL_CALL(glDeleteVertexArrays(1, &vertex_array_object));
 #endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+    if (shape_vertex_array_object != 0)
+        GL_CALL(glDeleteVertexArrays(1, &shape_vertex_array_object));
+#endif
 
     // Restore modified GL state
     // This "glIsProgram()" check is required because if the program is "pending deletion" at the time of binding backup, it will have been deleted by now and will cause an OpenGL error. See #6220.
@@ -657,28 +869,55 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
 
     // Build texture atlas
+    // With texture swizzle we upload 1 byte per-pixel (unless the atlas uses colors), sampled as (1,1,1,R) so it stays compatible with user's existing shaders.
+    // Otherwise load as RGBA 32-bit (75% of the memory is wasted, but default font is so small). If your ImTextureId represent a higher-level concept than just a GL texture id, consider calling GetTexDataAsAlpha8() instead to save on GPU memory.
     unsigned char* pixels;
     int width, height;
-    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);   // Load as RGBA 32-bit (75% of the memory is wasted, but default font is so small) because it is more likely to be compatible with user's existing shaders. If your ImTextureId represent a higher-level concept than just a GL texture id, consider calling GetTexDataAsAlpha8() instead to save on GPU memory.
+    if (bd->HasTextureSwizzle)
+        io.Fonts->GetTexPageData(0, &pixels, &width, &height, &bd->FontTextureBytesPerPixel);
+    else
+        io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height, &bd->FontTextureBytesPerPixel);
 
     // Upload texture to graphics system
-    // (Bilinear sampling is required by default. Set 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines' or 'style.AntiAliasedLinesUseTex = false' to allow point/nearest sampling)
-    GLint last_texture;
+    // (Bilinear sampling is required by default. Set 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_NoBakedRoundCorners' or 'style.AntiAliasedLinesUseTex = style.AntiAliasedFillUseTex = false' to allow point/nearest sampling)
+    GLint last_texture, last_unpack_alignment;
     GL_CALL(glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture));
-    GL_CALL(glGenTextures(1, &bd->FontTexture));
-    GL_CALL(glBindTexture(GL_TEXTURE_2D, bd->FontTexture));
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+    GL_CALL(glGetIntegerv(GL_UNPACK_ALIGNMENT, &last_unpack_alignment));
+    GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
 #ifdef GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
     GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
 #endif
-    GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+    GL_CALL(glGenTextures(1, &bd->FontTexture));
+    ImGui_ImplOpenGL3_CreateFontTexturePage(bd->FontTexture, pixels, width, height, bd->FontTextureBytesPerPixel);
+    io.Fonts->TexDirtyRects.resize(0);
 
     // Store our identifier
     io.Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
 
+    // Upload additional texture pages (only when glyphs didn't fit in io.Fonts->TexMaxHeight, or for ImFontConfig::SDF fonts)
+    bd->FontTexturePages.resize(io.Fonts->GetTexPageCount() - 1);
+    bd->FontTexturesSDF.resize(0);
+    if (bd->FontTexturePages.Size > 0)
+        GL_CALL(glGenTextures(bd->FontTexturePages.Size, bd->FontTexturePages.Data));
+    for (int page_n = 1; page_n < io.Fonts->GetTexPageCount(); page_n++)
+    {
+        if (bd->FontTextureBytesPerPixel == 1)
+            io.Fonts->GetTexPageDataAsAlpha8(page_n, &pixels, &width, &height);
+        else
+            io.Fonts->GetTexPageDataAsRGBA32(page_n, &pixels, &width, &height);
+        ImGui_ImplOpenGL3_CreateFontTexturePage(bd->FontTexturePages[page_n - 1], pixels, width, height, bd->FontTextureBytesPerPixel);
+        io.Fonts->SetTexPageID(page_n, (ImTextureID)(intptr_t)bd->FontTexturePages[page_n - 1]);
+        if (io.Fonts->IsTexPageSDF(page_n) && bd->SdfShaderHandle != 0)
+            bd->FontTexturesSDF.push_back(bd->FontTexturePages[page_n - 1]);
+    }
+
+    // Free CPU copy of the pixels (the texture can't be updated with ImFontAtlasFlags_DynamicGlyphs)
+    if ((io.Fonts->Flags & ImFontAtlasFlags_ClearTexDataAfterUpload) && !(io.Fonts->Flags & ImFontAtlasFlags_DynamicGlyphs))
+        io.Fonts->ClearTexData();
+
     // Restore state
     GL_CALL(glBindTexture(GL_TEXTURE_2D, last_texture));
+    GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, last_unpack_alignment));
 
     return true;
 }
@@ -693,6 +932,14 @@ void ImGui_ImplOpenGL3_DestroyFontsTexture()
         io.Fonts->SetTexID(0);
         bd->FontTexture = 0;
     }
+    if (bd->FontTexturePages.Size > 0)
+    {
+        glDeleteTextures(bd->FontTexturePages.Size, bd->FontTexturePages.Data);
+        for (int page_n = 1; page_n < io.Fonts->GetTexPageCount(); page_n++)
+            io.Fonts->SetTexPageID(page_n, 0);
+        bd->FontTexturePages.clear();
+        bd->FontTexturesSDF.clear();
+    }
 }
 
 // If you get an error please report on github. You may try different GL context version or GLSL version. See GL<>GLSL version table at the top of this file.
@@ -896,7 +1143,6 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
 
     glDetachShader(bd->ShaderHandle, vert_handle);
     glDetachShader(bd->ShaderHandle, frag_handle);
-    glDeleteShader(vert_handle);
     glDeleteShader(frag_handle);
 
     bd->AttribLocationTex = glGetUniformLocation(bd->ShaderHandle, "Texture");
@@ -905,6 +1151,134 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
     bd->AttribLocationVtxUV = (GLuint)glGetAttribLocation(bd->ShaderHandle, "UV");
     bd->AttribLocationVtxColor = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Color");
 
+    // Distance field program for ImFontConfig::SDF font pages (a single fragment shader for GLSL 1.30+, vertex shader and attribute locations shared with the main program)
+    // Alpha is 0.5 on glyph edges: smooth over the screen-space size of a pixel so edges stay sharp at any scale.
+    if (ImGui::GetIO().BackendFlags & ImGuiBackendFlags_RendererHasSDF)
+    {
+        const GLchar* fragment_shader_sdf =
+            "#ifdef GL_ES\n"
+            "    precision mediump float;\n"
+            "#endif\n"
+            "uniform sampler2D Texture;\n"
+            "in vec2 Frag_UV;\n"
+            "in vec4 Frag_Color;\n"
+            "out vec4 Out_Color;\n"
+            "void main()\n"
+            "{\n"
+            "    float d = texture(Texture, Frag_UV.st).a;\n"
+            "    float w = max(fwidth(d) * 0.5, 0.001);\n"
+            "    Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * smoothstep(0.5 - w, 0.5 + w, d));\n"
+            "}\n";
+
+        const GLchar* fragment_shader_sdf_with_version[2] = { bd->GlslVersionString, fragment_shader_sdf };
+        frag_handle = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(frag_handle, 2, fragment_shader_sdf_with_version, nullptr);
+        glCompileShader(frag_handle);
+        CheckShader(frag_handle, "sdf fragment shader");
+
+        bd->SdfShaderHandle = glCreateProgram();
+        glAttachShader(bd->SdfShaderHandle, vert_handle);
+        glAttachShader(bd->SdfShaderHandle, frag_handle);
+        glBindAttribLocation(bd->SdfShaderHandle, bd->AttribLocationVtxPos, "Position");
+        glBindAttribLocation(bd->SdfShaderHandle, bd->AttribLocationVtxUV, "UV");
+        glBindAttribLocation(bd->SdfShaderHandle, bd->AttribLocationVtxColor, "Color");
+        glLinkProgram(bd->SdfShaderHandle);
+        const bool sdf_program_ok = CheckProgram(bd->SdfShaderHandle, "sdf shader program");
+
+        glDetachShader(bd->SdfShaderHandle, vert_handle);
+        glDetachShader(bd->SdfShaderHandle, frag_handle);
+        glDeleteShader(frag_handle);
+
+        if (sdf_program_ok)
+        {
+            bd->AttribLocationSdfTex = glGetUniformLocation(bd->SdfShaderHandle, "Texture");
+            bd->AttribLocationSdfProjMtx = glGetUniformLocation(bd->SdfShaderHandle, "ProjMtx");
+        }
+        else
+        {
+            // Stop advertising SDF support (NewFrame() asserts if the atlas has SDF pages) rather than binding an invalid program every frame
+            glDeleteProgram(bd->SdfShaderHandle);
+            bd->SdfShaderHandle = 0;
+            ImGui::GetIO().BackendFlags &= ~ImGuiBackendFlags_RendererHasSDF;
+        }
+    }
+    glDeleteShader(vert_handle);
+
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+    // Shape instances program (a single version for GLSL 1.30+ as we only use 'in'/'out' qualifiers)
+    if (ImGui::GetIO().BackendFlags & ImGuiBackendFlags_RendererHasShapes)
+    {
+        const GLchar* vertex_shader_shapes =
+            "uniform mat4 ProjMtx;\n"
+            "in vec4 Rect;\n"
+            "in vec2 Params;\n"
+            "in vec4 Color;\n"
+            "out vec2 Frag_Pos;\n"
+            "out vec4 Frag_Rect;\n"
+            "out vec2 Frag_Params;\n"
+            "out vec4 Frag_Color;\n"
+            "void main()\n"
+            "{\n"
+            "    float expand = Params.y * 0.5 + 1.0;\n"
+            "    vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));\n"
+            "    Frag_Pos = mix(Rect.xy - expand, Rect.zw + expand, corner);\n"
+            "    Frag_Rect = Rect;\n"
+            "    Frag_Params = Params;\n"
+            "    Frag_Color = Color;\n"
+            "    gl_Position = ProjMtx * vec4(Frag_Pos.xy,0,1);\n"
+            "}\n";
+
+        const GLchar* fragment_shader_shapes =
+            "#ifdef GL_ES\n"
+            "    precision highp float;\n"
+            "#endif\n"
+            "in vec2 Frag_Pos;\n"
+            "in vec4 Frag_Rect;\n"
+            "in vec2 Frag_Params;\n"
+            "in vec4 Frag_Color;\n"
+            "out vec4 Out_Color;\n"
+            "void main()\n"
+            "{\n"
+            "    vec2 half_size = (Frag_Rect.zw - Frag_Rect.xy) * 0.5;\n"
+            "    vec2 p = abs(Frag_Pos - (Frag_Rect.xy + Frag_Rect.zw) * 0.5);\n"
+            "    float r = min(Frag_Params.x, min(half_size.x, half_size.y));\n"
+            "    vec2 q = p - half_size + r;\n"
+            "    float d = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - r;\n"
+            "    float coverage = (Frag_Params.y > 0.0) ? (Frag_Params.y * 0.5 + 0.5 - abs(d)) : (0.5 - d);\n"
+            "    Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * clamp(coverage, 0.0, 1.0));\n"
+            "}\n";
+
+        const GLchar* vertex_shader_shapes_with_version[2] = { bd->GlslVersionString, vertex_shader_shapes };
+        vert_handle = glCreateShader(GL_VERTEX_SHADER);
+        glShaderSource(vert_handle, 2, vertex_shader_shapes_with_version, nullptr);
+        glCompileShader(vert_handle);
+        CheckShader(vert_handle, "shapes vertex shader");
+
+        const GLchar* fragment_shader_shapes_with_version[2] = { bd->GlslVersionString, fragment_shader_shapes };
+        frag_handle = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(frag_handle, 2, fragment_shader_shapes_with_version, nullptr);
+        glCompileShader(frag_handle);
+        CheckShader(frag_handle, "shapes fragment shader");
+
+        bd->ShapeShaderHandle = glCreateProgram();
+        glAttachShader(bd->ShapeShaderHandle, vert_handle);
+        glAttachShader(bd->ShapeShaderHandle, frag_handle);
+        glLinkProgram(bd->ShapeShaderHandle);
+        CheckProgram(bd->ShapeShaderHandle, "shapes shader program");
+
+        glDetachShader(bd->ShapeShaderHandle, vert_handle);
+        glDetachShader(bd->ShapeShaderHandle, frag_handle);
+        glDeleteShader(vert_handle);
+        glDeleteShader(frag_handle);
+
+        bd->AttribLocationShapeProjMtx = glGetUniformLocation(bd->ShapeShaderHandle, "ProjMtx");
+        bd->AttribLocationShapeRect = (GLuint)glGetAttribLocation(bd->ShapeShaderHandle, "Rect");
+        bd->AttribLocationShapeParams = (GLuint)glGetAttribLocation(bd->ShapeShaderHandle, "Params");
+        bd->AttribLocationShapeColor = (GLuint)glGetAttribLocation(bd->ShapeShaderHandle, "Color");
+        glGenBuffers(1, &bd->ShapeVboHandle);
+    }
+#endif
+
     // Create buffers
     glGenBuffers(1, &bd->VboHandle);
     glGenBuffers(1, &bd->ElementsHandle);
@@ -927,6 +1301,9 @@ void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
     if (bd->VboHandle)      { glDeleteBuffers(1, &bd->VboHandle); bd->VboHandle = 0; }
     if (bd->ElementsHandle) { glDeleteBuffers(1, &bd->ElementsHandle); bd->ElementsHandle = 0; }
     if (bd->ShaderHandle)   { glDeleteProgram(bd->ShaderHandle); bd->ShaderHandle = 0; }
+    if (bd->ShapeVboHandle) { glDeleteBuffers(1, &bd->ShapeVboHandle); bd->ShapeVboHandle = 0; }
+    if (bd->ShapeShaderHandle) { glDeleteProgram(bd->ShapeShaderHandle); bd->ShapeShaderHandle = 0; }
+    if (bd->SdfShaderHandle) { glDeleteProgram(bd->SdfShaderHandle); bd->SdfShaderHandle = 0; }
     ImGui_ImplOpenGL3_DestroyFontsTexture();
 }
 
@@ -18,6 +18,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-16: Added ImGui_ImplSDL2_WaitForEvent() to wait for events until io.NextFrameDeadline, reducing CPU usage while idle.
 //  2023-04-06: Inputs: Avoid calling SDL_StartTextInput()/SDL_StopTextInput() as they don't only pertain to IME. It's unclear exactly what their relation is to IME. (#6306)
 //  2023-04-04: Inputs: Added support for io.AddMouseSourceEvent() to discriminate ImGuiMouseSource_Mouse/ImGuiMouseSource_TouchScreen. (#2702)
 //  2023-02-23: Accept SDL_GetPerformanceCounter() not returning a monotonically increasing value. (#6189, #6114, #3644)
@@ -647,6 +648,32 @@ void ImGui_ImplSDL2_NewFrame()
     ImGui_ImplSDL2_UpdateGamepads();
 }
 
+// Wait until an event is available or Dear ImGui needs a new frame (io.NextFrameDeadline), to reduce CPU/GPU usage while idle.
+// Call from your main loop before your SDL_PollEvent() loop, after rendering. The event is left in the queue. Use 'max_timeout' (in seconds) to limit waiting, e.g. for your own animations.
+void ImGui_ImplSDL2_WaitForEvent(double max_timeout)
+{
+#ifndef __EMSCRIPTEN__
+    ImGui_ImplSDL2_Data* bd = ImGui_ImplSDL2_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Did you call ImGui_ImplSDL2_Init()?");
+    ImGuiIO& io = ImGui::GetIO();
+
+    // io.NextFrameDeadline is expressed in ImGui::GetTime() timeline, which was in sync with bd->Time during the last ImGui_ImplSDL2_NewFrame() call.
+    Uint64 current_time = SDL_GetPerformanceCounter();
+    const double elapsed = (current_time > bd->Time) ? (double)(current_time - bd->Time) / (double)SDL_GetPerformanceFrequency() : 0.0;
+    double timeout = io.NextFrameDeadline - ImGui::GetTime() - elapsed;
+    if (timeout > max_timeout)
+        timeout = max_timeout;
+    if (timeout <= 0.0)
+        return;
+    if (timeout >= (double)FLT_MAX)
+        SDL_WaitEvent(nullptr);
+    else
+        SDL_WaitEventTimeout(nullptr, (timeout < 1000000.0) ? (int)(timeout * 1000.0) + 1 : 1000000000);
+#else
+    IM_UNUSED(max_timeout);
+#endif
+}
+
 //-----------------------------------------------------------------------------
 
 #if defined(__clang__)
@@ -10,12 +10,14 @@
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'SDL_Texture*' as ImTextureID. Read the FAQ about ImTextureID!
 //  [X] Renderer: Large meshes support (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Font atlas kept as 1 byte per-pixel on CPU side, expanded to RGBA32 by bands of rows while uploading (SDL_Renderer has no single channel texture format).
 
 // You can copy and use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
 // If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
 // Read online: https://github.com/ocornut/imgui/tree/master/docs
 
 // CHANGELOG
+//  2026-10-16: Upload font atlas from its 1 byte per-pixel data, without keeping a full RGBA32 copy in ImFontAtlas::TexPixelsRGBA32. Honor ImFontAtlasFlags_ClearTexDataAfterUpload.
 //  2023-05-30: Renamed imgui_impl_sdlrenderer.h/.cpp to imgui_impl_sdlrenderer2.h/.cpp to accommodate for upcoming SDL3.
 //  2022-10-11: Using 'nullptr' instead of 'NULL' as per our switch to C++11.
 //  2021-12-21: Update SDL_RenderGeometryRaw() format to work with SDL 2.0.19.
@@ -26,6 +28,11 @@
 #include "imgui.h"
 #ifndef IMGUI_DISABLE
 #include "imgui_impl_sdlrenderer2.h"
+
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+#error IMGUI_USE_COMPACT_DRAWVERT is not supported by this backend, which reads ImDrawVert positions and UV as 32-bit floats.
+#endif
+
 #include <stdint.h>     // intptr_t
 
 // Clang warnings with -Weverything
@@ -209,25 +216,49 @@ bool ImGui_ImplSDLRenderer2_CreateFontsTexture()
     ImGui_ImplSDLRenderer2_Data* bd = ImGui_ImplSDLRenderer2_GetBackendData();
 
     // Build texture atlas
+    // Load as 1 byte per-pixel unless the atlas uses colors. SDL_Renderer has no single channel texture format so we still create a RGBA 32-bit texture (75% of the GPU memory is wasted, but default font is so small).
     unsigned char* pixels;
-    int width, height;
-    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);   // Load as RGBA 32-bit (75% of the memory is wasted, but default font is so small) because it is more likely to be compatible with user's existing shaders. If your ImTextureId represent a higher-level concept than just a GL texture id, consider calling GetTexDataAsAlpha8() instead to save on GPU memory.
+    int width, height, bytes_per_pixel;
+    io.Fonts->GetTexPageData(0, &pixels, &width, &height, &bytes_per_pixel);
 
     // Upload texture to graphics system
-    // (Bilinear sampling is required by default. Set 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines' or 'style.AntiAliasedLinesUseTex = false' to allow point/nearest sampling)
+    // (Bilinear sampling is required by default. Set 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_NoBakedRoundCorners' or 'style.AntiAliasedLinesUseTex = style.AntiAliasedFillUseTex = false' to allow point/nearest sampling)
     bd->FontTexture = SDL_CreateTexture(bd->SDLRenderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, width, height);
     if (bd->FontTexture == nullptr)
     {
         SDL_Log("error creating texture");
         return false;
     }
-    SDL_UpdateTexture(bd->FontTexture, nullptr, pixels, 4 * width);
+    if (bytes_per_pixel == 4)
+    {
+        SDL_UpdateTexture(bd->FontTexture, nullptr, pixels, 4 * width);
+    }
+    else
+    {
+        // Expand to RGBA32 by bands of rows, so a full size copy never exists in memory
+        const int band_height = 32;
+        ImVector<Uint32> band_pixels;
+        band_pixels.resize(width * band_height);
+        for (int band_y = 0; band_y < height; band_y += band_height)
+        {
+            const int band_h = (height - band_y < band_height) ? height - band_y : band_height;
+            const unsigned char* src = pixels + (size_t)band_y * width;
+            for (int n = 0; n < width * band_h; n++)
+                band_pixels.Data[n] = IM_COL32(255, 255, 255, src[n]);
+            SDL_Rect band_rect = { 0, band_y, width, band_h };
+            SDL_UpdateTexture(bd->FontTexture, &band_rect, band_pixels.Data, 4 * width);
+        }
+    }
     SDL_SetTextureBlendMode(bd->FontTexture, SDL_BLENDMODE_BLEND);
     SDL_SetTextureScaleMode(bd->FontTexture, SDL_ScaleModeLinear);
 
     // Store our identifier
     io.Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
 
+    // Free CPU copy of the pixels
+    if ((io.Fonts->Flags & ImFontAtlasFlags_ClearTexDataAfterUpload) && !(io.Fonts->Flags & ImFontAtlasFlags_DynamicGlyphs))
+        io.Fonts->ClearTexData();
+
     return true;
 }
 
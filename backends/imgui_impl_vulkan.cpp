@@ -4,6 +4,8 @@
 // Implemented features:
 //  [!] Renderer: User texture binding. Use 'VkDescriptorSet' as ImTextureID. Read the FAQ about ImTextureID! See https://github.com/ocornut/imgui/pull/914 for discussions.
 //  [X] Renderer: Large meshes support (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Partial font texture updates (ImGuiBackendFlags_RendererHasTexUpdates) for ImFontAtlasFlags_DynamicGlyphs. Requires calling ImGui_ImplVulkan_UpdateFontsTexture() before the render pass.
+//  [X] Renderer: Single channel font texture (VK_FORMAT_R8_UNORM) sampled with a (1,1,1,R) component swizzle.
 
 // Important: on 32-bit systems, user texture binding is only supported if your imconfig file has '#define ImTextureID ImU64'.
 // This is because we need ImTextureID to carry a 64-bit value and by default ImTextureID is defined as void*.
@@ -30,6 +32,9 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-16: Vulkan: Upload font atlas as a VK_FORMAT_R8_UNORM image with (1,1,1,R) view swizzle unless it uses colors, saving 75% of texture and staging memory. Honor ImFontAtlasFlags_ClearTexDataAfterUpload.
+//  2026-10-16: Vulkan: Added ImGui_ImplVulkan_UpdateFontsTexture() to upload ImFontAtlas::TexDirtyRects[] outside of the render pass. Sets ImGuiBackendFlags_RendererHasTexUpdates.
+//  2026-10-16: Vulkan: Added support for compact vertex layout enabled with IMGUI_USE_COMPACT_DRAWVERT.
 //  2023-07-04: Vulkan: Added optional support for VK_KHR_dynamic_rendering. User needs to set init_info->UseDynamicRendering = true and init_info->ColorAttachmentFormat.
 //  2023-01-02: Vulkan: Fixed sampler passed to ImGui_ImplVulkan_AddTexture() not being honored + removed a bunch of duplicate code.
 //  2022-10-11: Using 'nullptr' instead of 'NULL' as per our switch to C++11.
@@ -86,6 +91,9 @@ struct ImGui_ImplVulkanH_FrameRenderBuffers
     VkDeviceSize        IndexBufferSize;
     VkBuffer            VertexBuffer;
     VkBuffer            IndexBuffer;
+    VkDeviceMemory      FontUploadBufferMemory;     // Staging buffer for ImGui_ImplVulkan_UpdateFontsTexture()
+    VkDeviceSize        FontUploadBufferSize;
+    VkBuffer            FontUploadBuffer;
 };
 
 // Each viewport will hold 1 ImGui_ImplVulkanH_WindowRenderBuffers
@@ -117,6 +125,7 @@ struct ImGui_ImplVulkan_Data
     VkImage                     FontImage;
     VkImageView                 FontView;
     VkDescriptorSet             FontDescriptorSet;
+    int                         FontBytesPerPixel;      // 1 = VK_FORMAT_R8_UNORM image sampled as (1,1,1,R), 4 = VK_FORMAT_R8G8B8A8_UNORM image
     VkDeviceMemory              UploadBufferMemory;
     VkBuffer                    UploadBuffer;
 
@@ -437,11 +446,32 @@ static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline
         float translate[2];
         translate[0] = -1.0f - draw_data->DisplayPos.x * scale[0];
         translate[1] = -1.0f - draw_data->DisplayPos.y * scale[1];
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        // Positions are fixed point, read as integer values by the vertex input stage (same as OpenGL backend)
+        scale[0] /= IM_DRAWVERT_POS_ONE;
+        scale[1] /= IM_DRAWVERT_POS_ONE;
+#endif
         vkCmdPushConstants(command_buffer, bd->PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, sizeof(float) * 0, sizeof(float) * 2, scale);
         vkCmdPushConstants(command_buffer, bd->PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, sizeof(float) * 2, sizeof(float) * 2, translate);
     }
 }
 
+static ImGui_ImplVulkanH_WindowRenderBuffers* ImGui_ImplVulkan_GetWindowRenderBuffers()
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    ImGui_ImplVulkanH_WindowRenderBuffers* wrb = &bd->MainWindowRenderBuffers;
+    if (wrb->FrameRenderBuffers == nullptr)
+    {
+        wrb->Index = 0;
+        wrb->Count = v->ImageCount;
+        wrb->FrameRenderBuffers = (ImGui_ImplVulkanH_FrameRenderBuffers*)IM_ALLOC(sizeof(ImGui_ImplVulkanH_FrameRenderBuffers) * wrb->Count);
+        memset(wrb->FrameRenderBuffers, 0, sizeof(ImGui_ImplVulkanH_FrameRenderBuffers) * wrb->Count);
+    }
+    IM_ASSERT(wrb->Count == v->ImageCount);
+    return wrb;
+}
+
 // Render function
 void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer command_buffer, VkPipeline pipeline)
 {
@@ -457,15 +487,7 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
         pipeline = bd->Pipeline;
 
     // Allocate array to store enough vertex/index buffers
-    ImGui_ImplVulkanH_WindowRenderBuffers* wrb = &bd->MainWindowRenderBuffers;
-    if (wrb->FrameRenderBuffers == nullptr)
-    {
-        wrb->Index = 0;
-        wrb->Count = v->ImageCount;
-        wrb->FrameRenderBuffers = (ImGui_ImplVulkanH_FrameRenderBuffers*)IM_ALLOC(sizeof(ImGui_ImplVulkanH_FrameRenderBuffers) * wrb->Count);
-        memset(wrb->FrameRenderBuffers, 0, sizeof(ImGui_ImplVulkanH_FrameRenderBuffers) * wrb->Count);
-    }
-    IM_ASSERT(wrb->Count == v->ImageCount);
+    ImGui_ImplVulkanH_WindowRenderBuffers* wrb = ImGui_ImplVulkan_GetWindowRenderBuffers();
     wrb->Index = (wrb->Index + 1) % wrb->Count;
     ImGui_ImplVulkanH_FrameRenderBuffers* rb = &wrb->FrameRenderBuffers[wrb->Index];
 
@@ -590,10 +612,12 @@ bool ImGui_ImplVulkan_CreateFontsTexture(VkCommandBuffer command_buffer)
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
     ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
 
+    // Single channel unless the atlas uses colors: the image view swizzle makes it read as white RGBA32 pixels by our shader (and user shaders).
     unsigned char* pixels;
     int width, height;
-    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
-    size_t upload_size = width * height * 4 * sizeof(char);
+    io.Fonts->GetTexPageData(0, &pixels, &width, &height, &bd->FontBytesPerPixel);
+    const VkFormat format = (bd->FontBytesPerPixel == 1) ? VK_FORMAT_R8_UNORM : VK_FORMAT_R8G8B8A8_UNORM;
+    size_t upload_size = (size_t)width * height * bd->FontBytesPerPixel * sizeof(char);
 
     VkResult err;
 
@@ -602,7 +626,7 @@ bool ImGui_ImplVulkan_CreateFontsTexture(VkCommandBuffer command_buffer)
         VkImageCreateInfo info = {};
         info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
         info.imageType = VK_IMAGE_TYPE_2D;
-        info.format = VK_FORMAT_R8G8B8A8_UNORM;
+        info.format = format;
         info.extent.width = width;
         info.extent.height = height;
         info.extent.depth = 1;
@@ -633,7 +657,14 @@ bool ImGui_ImplVulkan_CreateFontsTexture(VkCommandBuffer command_buffer)
         info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
         info.image = bd->FontImage;
         info.viewType = VK_IMAGE_VIEW_TYPE_2D;
-        info.format = VK_FORMAT_R8G8B8A8_UNORM;
+        info.format = format;
+        if (bd->FontBytesPerPixel == 1)
+        {
+            info.components.r = VK_COMPONENT_SWIZZLE_ONE;
+            info.components.g = VK_COMPONENT_SWIZZLE_ONE;
+            info.components.b = VK_COMPONENT_SWIZZLE_ONE;
+            info.components.a = VK_COMPONENT_SWIZZLE_R;
+        }
         info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
         info.subresourceRange.levelCount = 1;
         info.subresourceRange.layerCount = 1;
@@ -721,10 +752,112 @@ bool ImGui_ImplVulkan_CreateFontsTexture(VkCommandBuffer command_buffer)
 
     // Store our identifier
     io.Fonts->SetTexID((ImTextureID)bd->FontDescriptorSet);
+    io.Fonts->TexDirtyRects.resize(0);
+
+    // Free CPU copy of the pixels (the texture can't be updated with ImFontAtlasFlags_DynamicGlyphs)
+    if ((io.Fonts->Flags & ImFontAtlasFlags_ClearTexDataAfterUpload) && !(io.Fonts->Flags & ImFontAtlasFlags_DynamicGlyphs))
+        io.Fonts->ClearTexData();
 
     return true;
 }
 
+// Upload regions of the atlas modified since the texture was created or last updated (ImFontAtlasFlags_DynamicGlyphs).
+// Transfer commands are not allowed within a render pass, so this needs to be recorded before beginning the render pass used by ImGui_ImplVulkan_RenderDrawData().
+// The staging buffer belongs to the frame about to be rendered, so it follows the same lifetime rules as vertex/index buffers.
+void ImGui_ImplVulkan_UpdateFontsTexture(VkCommandBuffer command_buffer)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    ImFontAtlas* atlas = io.Fonts;
+    if (bd->FontImage == VK_NULL_HANDLE || atlas->TexDirtyRects.Size == 0)
+        return;
+
+    // Use the same format as the image
+    unsigned char* pixels;
+    int width, height;
+    const int bpp = bd->FontBytesPerPixel;
+    if (bpp == 1)
+        atlas->GetTexDataAsAlpha8(&pixels, &width, &height);
+    else
+        atlas->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+    // Create or resize the staging buffer (rectangles start at 4 bytes aligned offsets, as required by vkCmdCopyBufferToImage() in Vulkan 1.0)
+    ImGui_ImplVulkanH_WindowRenderBuffers* wrb = ImGui_ImplVulkan_GetWindowRenderBuffers();
+    ImGui_ImplVulkanH_FrameRenderBuffers* rb = &wrb->FrameRenderBuffers[(wrb->Index + 1) % wrb->Count];
+    size_t upload_size = 0;
+    for (int n = 0; n < atlas->TexDirtyRects.Size; n++)
+        upload_size += ((size_t)atlas->TexDirtyRects[n].Width * atlas->TexDirtyRects[n].Height * bpp + 3) & ~(size_t)3;
+    if (rb->FontUploadBuffer == VK_NULL_HANDLE || rb->FontUploadBufferSize < upload_size)
+        CreateOrResizeBuffer(rb->FontUploadBuffer, rb->FontUploadBufferMemory, rb->FontUploadBufferSize, upload_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+
+    // Upload to Buffer, packing rectangles tightly
+    ImVector<VkBufferImageCopy> regions;
+    regions.resize(atlas->TexDirtyRects.Size);
+    memset(regions.Data, 0, (size_t)regions.size_in_bytes());
+    char* map = nullptr;
+    VkResult err = vkMapMemory(v->Device, rb->FontUploadBufferMemory, 0, rb->FontUploadBufferSize, 0, (void**)(&map));
+    check_vk_result(err);
+    size_t offset = 0;
+    for (int n = 0; n < atlas->TexDirtyRects.Size; n++)
+    {
+        const ImFontAtlasDirtyRect& r = atlas->TexDirtyRects[n];
+        for (int y = 0; y < r.Height; y++)
+            memcpy(map + offset + (size_t)y * r.Width * bpp, pixels + ((size_t)(r.Y + y) * width + r.X) * bpp, (size_t)r.Width * bpp);
+        VkBufferImageCopy& region = regions[n];
+        region.bufferOffset = offset;
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.layerCount = 1;
+        region.imageOffset.x = r.X;
+        region.imageOffset.y = r.Y;
+        region.imageExtent.width = r.Width;
+        region.imageExtent.height = r.Height;
+        region.imageExtent.depth = 1;
+        offset += ((size_t)r.Width * r.Height * bpp + 3) & ~(size_t)3;
+    }
+    VkMappedMemoryRange range[1] = {};
+    range[0].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+    range[0].memory = rb->FontUploadBufferMemory;
+    range[0].size = VK_WHOLE_SIZE;
+    err = vkFlushMappedMemoryRanges(v->Device, 1, range);
+    check_vk_result(err);
+    vkUnmapMemory(v->Device, rb->FontUploadBufferMemory);
+
+    // Copy to Image:
+    {
+        VkImageMemoryBarrier copy_barrier[1] = {};
+        copy_barrier[0].sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        copy_barrier[0].srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        copy_barrier[0].dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        copy_barrier[0].oldLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        copy_barrier[0].newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        copy_barrier[0].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        copy_barrier[0].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        copy_barrier[0].image = bd->FontImage;
+        copy_barrier[0].subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        copy_barrier[0].subresourceRange.levelCount = 1;
+        copy_barrier[0].subresourceRange.layerCount = 1;
+        vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, copy_barrier);
+
+        vkCmdCopyBufferToImage(command_buffer, rb->FontUploadBuffer, bd->FontImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, (uint32_t)regions.Size, regions.Data);
+
+        VkImageMemoryBarrier use_barrier[1] = {};
+        use_barrier[0].sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        use_barrier[0].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        use_barrier[0].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        use_barrier[0].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        use_barrier[0].newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        use_barrier[0].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        use_barrier[0].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        use_barrier[0].image = bd->FontImage;
+        use_barrier[0].subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        use_barrier[0].subresourceRange.levelCount = 1;
+        use_barrier[0].subresourceRange.layerCount = 1;
+        vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, use_barrier);
+    }
+    atlas->TexDirtyRects.resize(0);
+}
+
 static void ImGui_ImplVulkan_CreateShaderModules(VkDevice device, const VkAllocationCallbacks* allocator)
 {
     // Create the shader modules
@@ -771,11 +904,19 @@ static void ImGui_ImplVulkan_CreatePipeline(VkDevice device, const VkAllocationC
     VkVertexInputAttributeDescription attribute_desc[3] = {};
     attribute_desc[0].location = 0;
     attribute_desc[0].binding = binding_desc[0].binding;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    attribute_desc[0].format = VK_FORMAT_R16G16_SSCALED; // Optional for vertex buffers in the Vulkan spec: check VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT on devices you target
+#else
     attribute_desc[0].format = VK_FORMAT_R32G32_SFLOAT;
+#endif
     attribute_desc[0].offset = IM_OFFSETOF(ImDrawVert, pos);
     attribute_desc[1].location = 1;
     attribute_desc[1].binding = binding_desc[0].binding;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    attribute_desc[1].format = VK_FORMAT_R16G16_UNORM;
+#else
     attribute_desc[1].format = VK_FORMAT_R32G32_SFLOAT;
+#endif
     attribute_desc[1].offset = IM_OFFSETOF(ImDrawVert, uv);
     attribute_desc[2].location = 2;
     attribute_desc[2].binding = binding_desc[0].binding;
@@ -874,7 +1015,7 @@ bool ImGui_ImplVulkan_CreateDeviceObjects()
 
     if (!bd->FontSampler)
     {
-        // Bilinear sampling is required by default. Set 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines' or 'style.AntiAliasedLinesUseTex = false' to allow point/nearest sampling.
+        // Bilinear sampling is required by default. Set 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_NoBakedRoundCorners' or 'style.AntiAliasedLinesUseTex = style.AntiAliasedFillUseTex = false' to allow point/nearest sampling.
         VkSamplerCreateInfo info = {};
         info.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
         info.magFilter = VK_FILTER_LINEAR;
@@ -1015,6 +1156,7 @@ bool    ImGui_ImplVulkan_Init(ImGui_ImplVulkan_InitInfo* info, VkRenderPass rend
     io.BackendRendererUserData = (void*)bd;
     io.BackendRendererName = "imgui_impl_vulkan";
     io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTexUpdates; // We can upload ImFontAtlas::TexDirtyRects[] (requires calling ImGui_ImplVulkan_UpdateFontsTexture()).
 
     IM_ASSERT(info->Instance != VK_NULL_HANDLE);
     IM_ASSERT(info->PhysicalDevice != VK_NULL_HANDLE);
@@ -1044,7 +1186,7 @@ void ImGui_ImplVulkan_Shutdown()
     ImGui_ImplVulkan_DestroyDeviceObjects();
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTexUpdates);
     IM_DELETE(bd);
 }
 
@@ -1482,8 +1624,11 @@ void ImGui_ImplVulkanH_DestroyFrameRenderBuffers(VkDevice device, ImGui_ImplVulk
     if (buffers->VertexBufferMemory) { vkFreeMemory(device, buffers->VertexBufferMemory, allocator); buffers->VertexBufferMemory = VK_NULL_HANDLE; }
     if (buffers->IndexBuffer) { vkDestroyBuffer(device, buffers->IndexBuffer, allocator); buffers->IndexBuffer = VK_NULL_HANDLE; }
     if (buffers->IndexBufferMemory) { vkFreeMemory(device, buffers->IndexBufferMemory, allocator); buffers->IndexBufferMemory = VK_NULL_HANDLE; }
+    if (buffers->FontUploadBuffer) { vkDestroyBuffer(device, buffers->FontUploadBuffer, allocator); buffers->FontUploadBuffer = VK_NULL_HANDLE; }
+    if (buffers->FontUploadBufferMemory) { vkFreeMemory(device, buffers->FontUploadBufferMemory, allocator); buffers->FontUploadBufferMemory = VK_NULL_HANDLE; }
     buffers->VertexBufferSize = 0;
     buffers->IndexBufferSize = 0;
+    buffers->FontUploadBufferSize = 0;
 }
 
 void ImGui_ImplVulkanH_DestroyWindowRenderBuffers(VkDevice device, ImGui_ImplVulkanH_WindowRenderBuffers* buffers, const VkAllocationCallbacks* allocator)
@@ -317,6 +317,10 @@ static void FrameRender(ImGui_ImplVulkanH_Window* wd, ImDrawData* draw_data)
         err = vkBeginCommandBuffer(fd->CommandBuffer, &info);
         check_vk_result(err);
     }
+
+    // Upload glyphs rasterized on demand (needs to happen outside of the render pass)
+    ImGui_ImplVulkan_UpdateFontsTexture(fd->CommandBuffer);
+
     {
         VkRenderPassBeginInfo info = {};
         info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
@@ -46,6 +46,7 @@
 //#define IMGUI_DISABLE_DEFAULT_MATH_FUNCTIONS              // Don't implement ImFabs/ImSqrt/ImPow/ImFmod/ImCos/ImSin/ImAcos/ImAtan2 so you can implement them yourself.
 //#define IMGUI_DISABLE_FILE_FUNCTIONS                      // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite and ImFileHandle at all (replace them with dummies)
 //#define IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS              // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite and ImFileHandle so you can implement them yourself if you don't want to link with fopen/fclose/fread/fwrite. This will also disable the LogToTTY() function.
+//#define IMGUI_DISABLE_FILE_MAPPING                        // Don't implement mapping font files in memory with mmap()/MapViewOfFile() (ImFontAtlasFlags_MapFontFiles), always read them into heap memory with ImFileRead().
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
 //#define IMGUI_DISABLE_SSE                                 // Disable use of SSE intrinsics even if available
 
@@ -55,6 +56,10 @@
 //---- Pack colors to BGRA8 instead of RGBA8 (to avoid converting from one to another)
 //#define IMGUI_USE_BGRA_PACKED_COLOR
 
+//---- Use CRC32-C instead of CRC32 to hash IDs (ImHashStr/ImHashData), computed with SSE4.2 instructions when enabled in your compiler settings (e.g. '-msse4.2' or '/arch:AVX'): ~3x faster for typical labels.
+// Without SSE4.2 it uses a lookup table as fast as the default hash, giving the same IDs. IDs differ from the default hash: table settings saved in .ini files with the other hash are lost.
+//#define IMGUI_USE_CRC32C_HASH
+
 //---- Use 32-bit for ImWchar (default is 16-bit) to support unicode planes 1-16. (e.g. point beyond 0xFFFF like emoticons, dingbats, symbols, shapes, ancient languages, etc...)
 //#define IMGUI_USE_WCHAR32
 
@@ -86,6 +91,10 @@
 // The only purpose of this define is if you want force compilation of the stb_truetype backend ALONG with the FreeType backend.
 //#define IMGUI_ENABLE_STB_TRUETYPE
 
+//---- Use std::thread to build the font atlas in parallel when ImFontAtlas::BuildParallelForFunc is not set (default is to build on the calling thread)
+// Requires linking with your platform threads library (e.g. '-pthread'). Memory allocators set with ImGui::SetAllocatorFunctions() need to be thread-safe.
+//#define IMGUI_ENABLE_FONT_BUILD_THREADS
+
 //---- Define constructor and implicit cast operators to convert back<>forth between your math types and ImVec2/ImVec4.
 // This will be inlined as part of ImVec2 and ImVec4 class declarations.
 /*
@@ -106,6 +115,10 @@
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
 //#define ImDrawIdx unsigned int
 
+//---- Use compact 12 bytes vertices (default is 20 bytes): 16-bit fixed point positions, 16-bit normalized UV. Reduces vertex upload bandwidth.
+// Positions are limited to [-8192,+8192) with 0.25 pixel precision. Your renderer backend will need to support it (only imgui_impl_opengl3 and imgui_impl_vulkan do, other backends fail to compile).
+//#define IMGUI_USE_COMPACT_DRAWVERT
+
 //---- Override ImDrawCallback signature (will need to modify renderer backends accordingly)
 //struct ImDrawList;
 //struct ImDrawCmd;
@@ -368,7 +368,7 @@ CODE
     void MyImGuiRenderFunction(ImDrawData* draw_data)
     {
        // TODO: Setup render state: alpha-blending enabled, no face culling, no depth testing, scissor enabled
-       // TODO: Setup texture sampling state: sample with bilinear filtering (NOT point/nearest filtering). Use 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines;' to allow point/nearest filtering.
+       // TODO: Setup texture sampling state: sample with bilinear filtering (NOT point/nearest filtering). Use 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_NoBakedRoundCorners;' to allow point/nearest filtering.
        // TODO: Setup viewport covering draw_data->DisplayPos to draw_data->DisplayPos + draw_data->DisplaySize
        // TODO: Setup orthographic projection matrix cover draw_data->DisplayPos to draw_data->DisplayPos + draw_data->DisplaySize
        // TODO: Setup shader: vertex { float2 pos, float2 uv, u32 color }, fragment shader sample color from 1 texture, multiply by vertex color.
@@ -1088,6 +1088,7 @@ static void             UpdateKeyRoutingTable(ImGuiKeyRoutingTable* rt);
 
 // Misc
 static void             UpdateSettings();
+static void             UpdateTextSizeCache();
 static bool             UpdateWindowManualResize(ImGuiWindow* window, const ImVec2& size_auto_fit, int* border_held, int resize_grip_count, ImU32 resize_grip_col[4], const ImRect& visibility_rect);
 static void             RenderWindowOuterBorders(ImGuiWindow* window);
 static void             RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar_rect, bool title_bar_is_highlight, bool handle_borders_and_resize_grips, int resize_grip_count, const ImU32 resize_grip_col[4], float resize_grip_draw_size);
@@ -1189,6 +1190,7 @@ ImGuiStyle::ImGuiStyle()
     AntiAliasedLines        = true;             // Enable anti-aliased lines/borders. Disable if you are really tight on CPU/GPU.
     AntiAliasedLinesUseTex  = true;             // Enable anti-aliased lines/borders using textures where possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
     AntiAliasedFill         = true;             // Enable anti-aliased filled shapes (rounded rectangles, circles, etc.).
+    AntiAliasedFillUseTex   = false;            // Enable anti-aliased filled circles and rounded rectangles using textures where possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
     CurveTessellationTol    = 1.25f;            // Tessellation tolerance when using PathBezierCurveTo() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
     CircleTessellationMaxError = 0.30f;         // Maximum error (in pixels) allowed when using AddCircle()/AddCircleFilled() or drawing rounded corner rectangles with no explicit segment count specified. Decrease for higher quality but more geometry.
 
@@ -1279,6 +1281,10 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigDrawDataDirtyRects = false;
+    ConfigDrawDataFingerprint = false;
+    ConfigDrawDataMergeLists = false;
+    ConfigTextSizeCache = false;
     ConfigDebugBeginReturnValueOnce = false;
     ConfigDebugBeginReturnValueLoop = false;
 
@@ -1943,9 +1949,37 @@ void ImFormatStringToTempBufferV(const char** out_buf, const char** out_buf_end,
     }
 }
 
+// IMGUI_USE_CRC32C_HASH: CRC32-C is computed with the crc32 instruction of SSE4.2 when available, otherwise with a lookup table (same results).
+#if defined(IMGUI_USE_CRC32C_HASH) && defined(IMGUI_ENABLE_SSE) && (defined(__SSE4_2__) || defined(__AVX__))
+#define IMGUI_HASH_CRC32C_SSE42
+#endif
+
+#ifndef IMGUI_HASH_CRC32C_SSE42
+
 // CRC32 needs a 1KB lookup table (not cache friendly)
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
 // - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
+#ifdef IMGUI_USE_CRC32C_HASH
+static const ImU32 GCrc32LookupTable[256] = // CRC32-C (Castagnoli polynomial)
+{
+    0x00000000,0xF26B8303,0xE13B70F7,0x1350F3F4,0xC79A971F,0x35F1141C,0x26A1E7E8,0xD4CA64EB,0x8AD958CF,0x78B2DBCC,0x6BE22838,0x9989AB3B,0x4D43CFD0,0xBF284CD3,0xAC78BF27,0x5E133C24,
+    0x105EC76F,0xE235446C,0xF165B798,0x030E349B,0xD7C45070,0x25AFD373,0x36FF2087,0xC494A384,0x9A879FA0,0x68EC1CA3,0x7BBCEF57,0x89D76C54,0x5D1D08BF,0xAF768BBC,0xBC267848,0x4E4DFB4B,
+    0x20BD8EDE,0xD2D60DDD,0xC186FE29,0x33ED7D2A,0xE72719C1,0x154C9AC2,0x061C6936,0xF477EA35,0xAA64D611,0x580F5512,0x4B5FA6E6,0xB93425E5,0x6DFE410E,0x9F95C20D,0x8CC531F9,0x7EAEB2FA,
+    0x30E349B1,0xC288CAB2,0xD1D83946,0x23B3BA45,0xF779DEAE,0x05125DAD,0x1642AE59,0xE4292D5A,0xBA3A117E,0x4851927D,0x5B016189,0xA96AE28A,0x7DA08661,0x8FCB0562,0x9C9BF696,0x6EF07595,
+    0x417B1DBC,0xB3109EBF,0xA0406D4B,0x522BEE48,0x86E18AA3,0x748A09A0,0x67DAFA54,0x95B17957,0xCBA24573,0x39C9C670,0x2A993584,0xD8F2B687,0x0C38D26C,0xFE53516F,0xED03A29B,0x1F682198,
+    0x5125DAD3,0xA34E59D0,0xB01EAA24,0x42752927,0x96BF4DCC,0x64D4CECF,0x77843D3B,0x85EFBE38,0xDBFC821C,0x2997011F,0x3AC7F2EB,0xC8AC71E8,0x1C661503,0xEE0D9600,0xFD5D65F4,0x0F36E6F7,
+    0x61C69362,0x93AD1061,0x80FDE395,0x72966096,0xA65C047D,0x5437877E,0x4767748A,0xB50CF789,0xEB1FCBAD,0x197448AE,0x0A24BB5A,0xF84F3859,0x2C855CB2,0xDEEEDFB1,0xCDBE2C45,0x3FD5AF46,
+    0x7198540D,0x83F3D70E,0x90A324FA,0x62C8A7F9,0xB602C312,0x44694011,0x5739B3E5,0xA55230E6,0xFB410CC2,0x092A8FC1,0x1A7A7C35,0xE811FF36,0x3CDB9BDD,0xCEB018DE,0xDDE0EB2A,0x2F8B6829,
+    0x82F63B78,0x709DB87B,0x63CD4B8F,0x91A6C88C,0x456CAC67,0xB7072F64,0xA457DC90,0x563C5F93,0x082F63B7,0xFA44E0B4,0xE9141340,0x1B7F9043,0xCFB5F4A8,0x3DDE77AB,0x2E8E845F,0xDCE5075C,
+    0x92A8FC17,0x60C37F14,0x73938CE0,0x81F80FE3,0x55326B08,0xA759E80B,0xB4091BFF,0x466298FC,0x1871A4D8,0xEA1A27DB,0xF94AD42F,0x0B21572C,0xDFEB33C7,0x2D80B0C4,0x3ED04330,0xCCBBC033,
+    0xA24BB5A6,0x502036A5,0x4370C551,0xB11B4652,0x65D122B9,0x97BAA1BA,0x84EA524E,0x7681D14D,0x2892ED69,0xDAF96E6A,0xC9A99D9E,0x3BC21E9D,0xEF087A76,0x1D63F975,0x0E330A81,0xFC588982,
+    0xB21572C9,0x407EF1CA,0x532E023E,0xA145813D,0x758FE5D6,0x87E466D5,0x94B49521,0x66DF1622,0x38CC2A06,0xCAA7A905,0xD9F75AF1,0x2B9CD9F2,0xFF56BD19,0x0D3D3E1A,0x1E6DCDEE,0xEC064EED,
+    0xC38D26C4,0x31E6A5C7,0x22B65633,0xD0DDD530,0x0417B1DB,0xF67C32D8,0xE52CC12C,0x1747422F,0x49547E0B,0xBB3FFD08,0xA86F0EFC,0x5A048DFF,0x8ECEE914,0x7CA56A17,0x6FF599E3,0x9D9E1AE0,
+    0xD3D3E1AB,0x21B862A8,0x32E8915C,0xC083125F,0x144976B4,0xE622F5B7,0xF5720643,0x07198540,0x590AB964,0xAB613A67,0xB831C993,0x4A5A4A90,0x9E902E7B,0x6CFBAD78,0x7FAB5E8C,0x8DC0DD8F,
+    0xE330A81A,0x115B2B19,0x020BD8ED,0xF0605BEE,0x24AA3F05,0xD6C1BC06,0xC5914FF2,0x37FACCF1,0x69E9F0D5,0x9B8273D6,0x88D28022,0x7AB90321,0xAE7367CA,0x5C18E4C9,0x4F48173D,0xBD23943E,
+    0xF36E6F75,0x0105EC76,0x12551F82,0xE03E9C81,0x34F4F86A,0xC69F7B69,0xD5CF889D,0x27A40B9E,0x79B737BA,0x8BDCB4B9,0x988C474D,0x6AE7C44E,0xBE2DA0A5,0x4C4623A6,0x5F16D052,0xAD7D5351,
+};
+#else
 static const ImU32 GCrc32LookupTable[256] =
 {
     0x00000000,0x77073096,0xEE0E612C,0x990951BA,0x076DC419,0x706AF48F,0xE963A535,0x9E6495A3,0x0EDB8832,0x79DCB8A4,0xE0D5E91E,0x97D2D988,0x09B64C2B,0x7EB17CBD,0xE7B82D07,0x90BF1D91,
@@ -1965,10 +1999,11 @@ static const ImU32 GCrc32LookupTable[256] =
     0xA00AE278,0xD70DD2EE,0x4E048354,0x3903B3C2,0xA7672661,0xD06016F7,0x4969474D,0x3E6E77DB,0xAED16A4A,0xD9D65ADC,0x40DF0B66,0x37D83BF0,0xA9BCAE53,0xDEBB9EC5,0x47B2CF7F,0x30B5FFE9,
     0xBDBDF21C,0xCABAC28A,0x53B39330,0x24B4A3A6,0xBAD03605,0xCDD70693,0x54DE5729,0x23D967BF,0xB3667A2E,0xC4614AB8,0x5D681B02,0x2A6F2B94,0xB40BBE37,0xC30C8EA1,0x5A05DF1B,0x2D02EF8D,
 };
+#endif
 
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
+// FIXME-OPT: CRC32 pretty much randomly access 1KB. See IMGUI_USE_CRC32C_HASH in imconfig.h to use SSE4.2 instructions instead.
 ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
 {
     ImU32 crc = ~seed;
@@ -1984,7 +2019,6 @@ ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
 // Because this syntax is rarely used we are optimizing for the common case.
 // - If we reach ### in the string we discard the hash so far and reset to the seed.
 // - We don't do 'current += 2; continue;' after handling ### to keep the code smaller/faster (measured ~10% diff in Debug build)
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
 ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
 {
     seed = ~seed;
@@ -2013,6 +2047,100 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
     return ~crc;
 }
 
+#else // #ifndef IMGUI_HASH_CRC32C_SSE42
+
+// Process 8 bytes at a time in 64-bit builds
+static ImU32 ImCrc32c(ImU32 crc, const unsigned char* data, size_t data_size)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    for (; data_size >= 8; data_size -= 8, data += 8)
+    {
+        ImU64 v;
+        memcpy(&v, data, 8);
+        crc = (ImU32)_mm_crc32_u64(crc, v);
+    }
+#endif
+    for (; data_size >= 4; data_size -= 4, data += 4)
+    {
+        ImU32 v;
+        memcpy(&v, data, 4);
+        crc = _mm_crc32_u32(crc, v);
+    }
+    if (data_size >= 2)
+    {
+        ImU16 v;
+        memcpy(&v, data, 2);
+        crc = _mm_crc32_u16(crc, v);
+        data_size -= 2;
+        data += 2;
+    }
+    if (data_size != 0)
+        crc = _mm_crc32_u8(crc, *data);
+    return crc;
+}
+
+ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
+{
+    return ~ImCrc32c(~seed, (const unsigned char*)data_p, data_size);
+}
+
+// Same "###" semantic as the lookup table version: the hash restarts from the seed at each "###", so we only hash from the last one.
+// Locating it first keeps the hashing loop free of per-byte checks.
+ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
+{
+    if (data_size == 0)
+        data_size = strlen(data_p);
+    const char* data_end = data_p + data_size;
+    for (const char* p = data_p; (p = (const char*)memchr(p, '#', (size_t)(data_end - p))) != NULL; p++)
+        if (data_end - p >= 3 && p[1] == '#' && p[2] == '#')
+            data_p = p;
+    return ImHashData(data_p, (size_t)(data_end - data_p), seed);
+}
+
+#endif // #ifndef IMGUI_HASH_CRC32C_SSE42
+
+// 64-bit hash reading 8 bytes at a time, to compare contents across frames (text sizes cache, draw data fingerprint) where a 32-bit
+// collision would silently return stale results. Multiply then xor-shift, so every input bit reaches both the low and the high bits.
+// Large buffers are hashed into 4 independent lanes. Not meant to be persisted: results depend on endianness.
+ImU64 ImHashData64(const void* data_p, size_t data_size, ImU64 seed)
+{
+    const ImU64 k = 0x9E3779B97F4A7C15ULL;
+    const unsigned char* data = (const unsigned char*)data_p;
+    ImU64 hash = seed ^ ((ImU64)data_size * k);
+    ImU64 word;
+    if (data_size >= 32)
+    {
+        ImU64 lanes[4] = { hash, hash + k, hash + k * 2, hash + k * 3 };
+        for (; data_size >= 32; data += 32, data_size -= 32)
+            for (int lane_n = 0; lane_n < 4; lane_n++)
+            {
+                memcpy(&word, data + lane_n * 8, 8);
+                lanes[lane_n] = (lanes[lane_n] ^ word) * k;
+                lanes[lane_n] ^= lanes[lane_n] >> 29;
+            }
+        hash = lanes[0];
+        for (int lane_n = 1; lane_n < 4; lane_n++)
+        {
+            hash = (hash ^ lanes[lane_n]) * k;
+            hash ^= hash >> 29;
+        }
+    }
+    for (; data_size >= 8; data += 8, data_size -= 8)
+    {
+        memcpy(&word, data, 8);
+        hash = (hash ^ word) * k;
+        hash ^= hash >> 29;
+    }
+    word = 0;
+    for (size_t n = 0; n < data_size; n++) // A variable-size memcpy() call would cost more than hashing short strings
+        word |= (ImU64)data[n] << (n * 8);
+    hash = (hash ^ word) * k;
+    hash ^= hash >> 32;
+    hash *= k;
+    hash ^= hash >> 29;
+    return hash;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (File functions)
 //-----------------------------------------------------------------------------
@@ -2086,6 +2214,104 @@ void*   ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_f
     return file_data;
 }
 
+// Helper: Map file content read-only into memory, sharing pages with the OS file cache instead of copying them.
+// ImFileMapOpen() returns NULL if mapping is disabled (IMGUI_DISABLE_FILE_MAPPING, or custom file functions), unsupported or failed: use ImFileLoadToMemory() instead.
+// Keep the file open to map it again later: this works after the working directory changed or the file was deleted/renamed (the same file is mapped).
+// Release mappings with ImFileUnmapFromMemory() and the file with ImFileMapClose(). The file shouldn't be truncated while mapped (reading would crash).
+#if !defined(IMGUI_DISABLE_FILE_MAPPING) && !defined(IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS)
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS) && !(defined(WINAPI_FAMILY) && (WINAPI_FAMILY == WINAPI_FAMILY_APP))
+#define IMGUI_FILE_MAPPING_WIN32
+#elif (defined(__unix__) || defined(__APPLE__)) && !defined(__EMSCRIPTEN__)
+#define IMGUI_FILE_MAPPING_POSIX
+#include <fcntl.h>      // open
+#include <sys/mman.h>   // mmap, munmap
+#include <sys/stat.h>   // fstat
+#include <unistd.h>     // close
+#endif
+#endif
+
+// Handles are HANDLE on Windows, (file descriptor + 1) on POSIX so NULL is never a valid handle.
+ImFileMapHandle ImFileMapOpen(const char* filename)
+{
+    IM_ASSERT(filename);
+#if defined(IMGUI_FILE_MAPPING_WIN32)
+    const int filename_wsize = ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, NULL, 0);
+    ImVector<wchar_t> buf;
+    buf.resize(filename_wsize);
+    ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, (wchar_t*)&buf[0], filename_wsize);
+    HANDLE file = ::CreateFileW((const wchar_t*)&buf[0], GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL); // Other processes can't write the file while it is open
+    return (file != INVALID_HANDLE_VALUE) ? (ImFileMapHandle)file : NULL;
+#elif defined(IMGUI_FILE_MAPPING_POSIX)
+    int fd = open(filename, O_RDONLY | O_CLOEXEC);
+    return (fd != -1) ? (ImFileMapHandle)(intptr_t)(fd + 1) : NULL;
+#else
+    IM_UNUSED(filename);
+    return NULL;
+#endif
+}
+
+void    ImFileMapClose(ImFileMapHandle file)
+{
+    IM_ASSERT(file != NULL);
+#if defined(IMGUI_FILE_MAPPING_WIN32)
+    ::CloseHandle((HANDLE)file);
+#elif defined(IMGUI_FILE_MAPPING_POSIX)
+    close((int)(intptr_t)file - 1);
+#else
+    IM_UNUSED(file);
+    IM_ASSERT(0 && "ImFileMapOpen() is not supported, nothing to close!");
+#endif
+}
+
+void*   ImFileMapToMemory(ImFileMapHandle file, size_t* out_file_size)
+{
+    IM_ASSERT(file && out_file_size);
+    *out_file_size = 0;
+#if defined(IMGUI_FILE_MAPPING_WIN32)
+    void* data = NULL;
+    LARGE_INTEGER file_size;
+    if (::GetFileSizeEx((HANDLE)file, &file_size) && file_size.QuadPart > 0 && (ImU64)file_size.QuadPart <= (ImU64)(size_t)-1)
+        if (HANDLE mapping = ::CreateFileMappingW((HANDLE)file, NULL, PAGE_READONLY, 0, 0, NULL))
+        {
+            data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            ::CloseHandle(mapping); // The view keeps the mapping alive
+            if (data != NULL)
+                *out_file_size = (size_t)file_size.QuadPart;
+        }
+    return data;
+#elif defined(IMGUI_FILE_MAPPING_POSIX)
+    const int fd = (int)(intptr_t)file - 1;
+    void* data = NULL;
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+            data = NULL;
+        else
+            *out_file_size = (size_t)st.st_size;
+    }
+    return data;
+#else
+    IM_UNUSED(file);
+    return NULL;
+#endif
+}
+
+void    ImFileUnmapFromMemory(void* data, size_t data_size)
+{
+    IM_ASSERT(data != NULL);
+#if defined(IMGUI_FILE_MAPPING_WIN32)
+    IM_UNUSED(data_size);
+    ::UnmapViewOfFile(data);
+#elif defined(IMGUI_FILE_MAPPING_POSIX)
+    munmap(data, data_size);
+#else
+    IM_UNUSED(data_size);
+    IM_ASSERT(0 && "ImFileMapToMemory() is not supported, nothing to unmap!");
+#endif
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (ImText* functions)
 //-----------------------------------------------------------------------------
@@ -2147,6 +2373,24 @@ int ImTextCharFromUtf8(unsigned int* out_char, const char* in_text, const char*
     return wanted;
 }
 
+// Used by ImFont::CalcTextSizeA() and ImFont::RenderText() to process runs of ASCII characters without UTF-8 decoding.
+const char* ImTextFindEndOfAsciiRun(const char* in_text, const char* in_text_end)
+{
+#if defined(IMGUI_ENABLE_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+    // Process 16 bytes at a time. As signed bytes, 0x20..0x7F are the only values greater than 0x1F (high bit set = negative).
+    const __m128i control_max = _mm_set1_epi8(0x1F);
+    while (in_text_end - in_text >= 16)
+    {
+        if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_loadu_si128((const __m128i*)(const void*)in_text), control_max)) != 0xFFFF)
+            break;
+        in_text += 16;
+    }
+#endif
+    while (in_text < in_text_end && (unsigned char)(*in_text - 0x20) < 0x60)
+        in_text++;
+    return in_text;
+}
+
 int ImTextStrFromUtf8(ImWchar* buf, int buf_size, const char* in_text, const char* in_text_end, const char** in_text_remaining)
 {
     ImWchar* buf_out = buf;
@@ -3304,12 +3548,60 @@ void ImGui::RenderTextWrapped(ImVec2 pos, const char* text, const char* text_end
 
     if (text != text_end)
     {
+        // Large text: reuse lines computed during previous frames and only render visible ones
+        if (wrap_width > 0.0f && text_end - text > IMGUI_TEXT_WRAP_LAYOUT_MIN_LENGTH && !g.LogEnabled)
+        {
+            RenderTextWrappedLayout(pos, text, GetTextWrapLayout(text, text_end, wrap_width));
+            return;
+        }
         window->DrawList->AddText(g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_end, wrap_width);
         if (g.LogEnabled)
             LogRenderedText(&pos, text, text_end);
     }
 }
 
+// Render lines of 'layout' (computed from 'text' with current font) which are within current clipping rectangle.
+void ImGui::RenderTextWrappedLayout(ImVec2 pos, const char* text, const ImGuiTextWrapLayout* layout)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    const float line_height = g.FontSize;
+    pos.y = IM_FLOOR(pos.y);
+    const int line_begin = ImMax((int)ImCeil((window->ClipRect.Min.y - pos.y) / line_height) - 1, 0); // Include line ending exactly at clipping rectangle, as glyphs may overflow
+    const int line_end = ImMin((int)((window->ClipRect.Max.y - pos.y) / line_height) + 1, layout->Lines.Size);
+    for (int line_n = line_begin; line_n < line_end; line_n++)
+    {
+        const ImGuiTextWrapLine& line = layout->Lines[line_n];
+        RenderText(ImVec2(pos.x, pos.y + line_n * line_height), text + line.Begin, text + line.End, false);
+    }
+}
+
+// Lines of a large word-wrapped text block, persisting across frames. Recomputed when contents or inputs changed.
+// Stored in current window and identified by submission order within the window and ID stack top, so the text pointer may change every frame
+// (e.g. formatted into g.TempBuffer) without leaking or evicting another block.
+ImGuiTextWrapLayout* ImGui::GetTextWrapLayout(const char* text, const char* text_end, float wrap_width)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    const int layout_n = window->DC.TextWrapLayoutsCount++;
+    const ImGuiID id = ImHashData(&layout_n, sizeof(layout_n), window->IDStack.back());
+    ImGuiTextWrapLayout* layout = NULL;
+    if (layout_n < window->TextWrapLayouts.Size && window->TextWrapLayouts[layout_n].ID == id) // Fast path: same submission order as previous frame
+        layout = &window->TextWrapLayouts[layout_n];
+    for (int n = 0; n < window->TextWrapLayouts.Size && layout == NULL; n++)
+        if (window->TextWrapLayouts[n].ID == id)
+            layout = &window->TextWrapLayouts[n];
+    if (layout == NULL)
+    {
+        window->TextWrapLayouts.push_back(ImGuiTextWrapLayout());
+        layout = &window->TextWrapLayouts.back();
+        layout->ID = id;
+    }
+    layout->LastUsedFrame = g.FrameCount;
+    layout->Update(g.Font, g.FontSize, wrap_width, text, text_end);
+    return layout;
+}
+
 // Default clip_rect uses (pos_min,pos_max)
 // Handle clipping on CPU immediately (vs typically let the GPU clip the triangles that are overlapping the clipping rectangle edges)
 // FIXME-OPT: Since we have or calculate text_size we could coarse clip whole block immediately, especally for text above draw_list->DrawList.
@@ -3623,6 +3915,7 @@ void ImGui::Shutdown()
     }
     g.IO.Fonts = NULL;
     g.DrawListSharedData.TempBuffer.clear();
+    g.TextSizeCache.Entries.clear();
 
     // Cleanup of other data are conditional on actually having initialized Dear ImGui.
     if (!g.Initialized)
@@ -3756,6 +4049,7 @@ ImGuiWindow::~ImGuiWindow()
     IM_ASSERT(DrawList == &DrawListInst);
     IM_DELETE(Name);
     ColumnsStorage.clear_destruct();
+    TextWrapLayouts.clear_destruct();
 }
 
 ImGuiID ImGuiWindow::GetID(const char* str, const char* str_end)
@@ -3831,6 +4125,7 @@ void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
     window->DC.ChildWindows.clear();
     window->DC.ItemWidthStack.clear();
     window->DC.TextWrapPosStack.clear();
+    window->TextWrapLayouts.clear_destruct();
 }
 
 void ImGui::GcAwakeTransientWindowBuffers(ImGuiWindow* window)
@@ -4069,10 +4364,16 @@ bool ImGui::IsItemHovered(ImGuiHoveredFlags flags)
         // but once unlocked on a given item we also moving.
         //if (g.HoverDelayTimer >= delay && (g.HoverDelayTimer - g.IO.DeltaTime < delay || g.MouseStationaryTimer - g.IO.DeltaTime < g.Style.HoverStationaryDelay)) { IMGUI_DEBUG_LOG("HoverDelayTimer = %f/%f, MouseStationaryTimer = %f\n", g.HoverDelayTimer, delay, g.MouseStationaryTimer); }
         if ((flags & ImGuiHoveredFlags_Stationary) != 0 && g.HoverItemUnlockedStationaryId != hover_delay_id)
+        {
+            RequestNextFrame(g.Style.HoverStationaryDelay - g.MouseStationaryTimer);
             return false;
+        }
 
         if (g.HoverItemDelayTimer < delay)
+        {
+            RequestNextFrame(delay - g.HoverItemDelayTimer);
             return false;
+        }
     }
 
     return true;
@@ -4259,6 +4560,12 @@ int ImGui::GetFrameCount()
     return GImGui->FrameCount;
 }
 
+void ImGui::RequestNextFrame(float delay)
+{
+    ImGuiContext& g = *GImGui;
+    g.IO.NextFrameDeadline = ImMin(g.IO.NextFrameDeadline, g.Time + (double)ImMax(delay, 0.0f));
+}
+
 static ImDrawList* GetViewportBgFgDrawList(ImGuiViewportP* viewport, size_t drawlist_no, const char* drawlist_name)
 {
     // Create the draw list on demand, because they are not frequently used for all viewports
@@ -4528,6 +4835,7 @@ void ImGui::NewFrame()
     g.WithinFrameScope = true;
     g.FrameCount += 1;
     g.TooltipOverrideCount = 0;
+    UpdateTextSizeCache();
     g.WindowsActiveCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
 
@@ -4542,6 +4850,13 @@ void ImGui::NewFrame()
     g.InputEventsTrail.resize(0);
     UpdateInputEvents(g.IO.ConfigInputTrickleEventQueue);
 
+    // Reset time of next required frame. Effects of input events generally need another frame to settle, and trickled events are left in the queue.
+    g.IO.NextFrameDeadline = FLT_MAX;
+    if (g.InputEventsTrail.Size > 0 || g.InputEventsQueue.Size > 0)
+        RequestNextFrame();
+    if (g.SettingsDirtyTimer > 0.0f)
+        RequestNextFrame(g.SettingsDirtyTimer);
+
     // Update viewports (after processing input queue, so io.MouseHoveredViewport is set)
     UpdateViewportsNewFrame();
 
@@ -4562,8 +4877,12 @@ void ImGui::NewFrame()
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLinesUseTex;
     if (g.Style.AntiAliasedFill)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
+    if (g.Style.AntiAliasedFill && g.Style.AntiAliasedFillUseTex && !(g.Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedRoundCorners))
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFillUseTex;
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset;
+    if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasShapes)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowShapes;
 
     // Mark rendering data as invalid to prevent user who may have a handle on it to use it.
     for (int n = 0; n < g.Viewports.Size; n++)
@@ -4699,6 +5018,8 @@ void ImGui::NewFrame()
         g.DimBgRatio = ImMin(g.DimBgRatio + g.IO.DeltaTime * 6.0f, 1.0f);
     else
         g.DimBgRatio = ImMax(g.DimBgRatio - g.IO.DeltaTime * 10.0f, 0.0f);
+    if ((g.DimBgRatio > 0.0f && g.DimBgRatio < 1.0f) || g.NavWindowingTarget != NULL || g.NavWindowingHighlightAlpha > 0.0f)
+        RequestNextFrame();
 
     g.MouseCursor = ImGuiMouseCursor_Arrow;
     g.WantCaptureMouseNextFrame = g.WantCaptureKeyboardNextFrame = g.WantTextInputNextFrame = -1;
@@ -4738,6 +5059,19 @@ void ImGui::NewFrame()
         GcCompactTransientMiscBuffers();
     g.GcCompactAll = false;
 
+    // Garbage collect lines of wrapped text blocks which weren't submitted during last frame
+    for (ImGuiWindow* window : g.Windows)
+        for (int n = 0; n < window->TextWrapLayouts.Size; )
+        {
+            if (window->TextWrapLayouts[n].LastUsedFrame >= g.FrameCount - 1)
+            {
+                n++;
+                continue;
+            }
+            window->TextWrapLayouts[n].Lines.clear();
+            window->TextWrapLayouts.erase(&window->TextWrapLayouts[n]);
+        }
+
     // Closing the focused window restore focus to the first active root window in descending z-order
     if (g.NavWindow && !g.NavWindow->WasActive)
         FocusTopMostWindowUnderOne(NULL, NULL, NULL, ImGuiFocusRequestFlags_RestoreFocusedChild);
@@ -4862,11 +5196,14 @@ static void InitViewportDrawData(ImGuiViewportP* viewport)
 
     draw_data->Valid = true;
     draw_data->CmdListsCount = 0;
-    draw_data->TotalVtxCount = draw_data->TotalIdxCount = 0;
+    draw_data->TotalVtxCount = draw_data->TotalIdxCount = draw_data->TotalShapeCount = 0;
     draw_data->DisplayPos = viewport->Pos;
     draw_data->DisplaySize = viewport->Size;
     draw_data->FramebufferScale = io.DisplayFramebufferScale;
     draw_data->OwnerViewport = viewport;
+    draw_data->Fingerprint = 0;
+    draw_data->Unchanged = false;
+    draw_data->DirtyRects.resize(0);
 }
 
 // Push a clipping rectangle for both ImGui logic (hit-testing etc.) and low-level ImDrawList rendering.
@@ -4906,7 +5243,8 @@ static void ImGui::RenderDimmedBackgroundBehindWindow(ImGuiWindow* window, ImU32
         if (draw_list->CmdBuffer.Size == 0)
             draw_list->AddDrawCmd();
         draw_list->PushClipRect(viewport_rect.Min - ImVec2(1, 1), viewport_rect.Max + ImVec2(1, 1), false); // FIXME: Need to stricty ensure ImDrawCmd are not merged (ElemCount==6 checks below will verify that)
-        draw_list->AddRectFilled(viewport_rect.Min, viewport_rect.Max, col);
+        draw_list->PrimReserve(6, 4); // Not using AddRectFilled() which may output a shape instance (ImDrawListFlags_ShapeInstances)
+        draw_list->PrimRect(viewport_rect.Min, viewport_rect.Max, col);
         ImDrawCmd cmd = draw_list->CmdBuffer.back();
         IM_ASSERT(cmd.ElemCount == 6);
         draw_list->CmdBuffer.pop_back();
@@ -5117,6 +5455,7 @@ void ImGui::Render()
 
     // Setup ImDrawData structures for end-user
     g.IO.MetricsRenderVertices = g.IO.MetricsRenderIndices = 0;
+    g.RenderDrawCmdsCount = g.RenderDrawCmdsCountBeforeMerge = 0;
     for (int n = 0; n < g.Viewports.Size; n++)
     {
         ImGuiViewportP* viewport = g.Viewports[n];
@@ -5130,7 +5469,22 @@ void ImGui::Render()
         ImDrawData* draw_data = &viewport->DrawDataP;
         IM_ASSERT(draw_data->CmdLists.Size == draw_data->CmdListsCount);
         for (int draw_list_n = 0; draw_list_n < draw_data->CmdLists.Size; draw_list_n++)
+        {
             draw_data->CmdLists[draw_list_n]->_PopUnusedDrawCmd();
+            g.RenderDrawCmdsCountBeforeMerge += draw_data->CmdLists[draw_list_n]->CmdBuffer.Size;
+        }
+
+        // Compare with previous frame
+        if (g.IO.ConfigDrawDataDirtyRects)
+            UpdateDrawDataDirtyRects(draw_data, &viewport->DrawDataDirtyTracker, g.FrameCount);
+        if (g.IO.ConfigDrawDataFingerprint)
+            UpdateDrawDataFingerprint(draw_data, &viewport->DrawDataDirtyTracker, g.FrameCount);
+
+        // Merge draw lists and draw commands across windows
+        if (g.IO.ConfigDrawDataMergeLists)
+            MergeDrawDataLists(draw_data, &viewport->DrawDataMergedLists);
+        for (int draw_list_n = 0; draw_list_n < draw_data->CmdLists.Size; draw_list_n++)
+            g.RenderDrawCmdsCount += draw_data->CmdLists[draw_list_n]->CmdBuffer.Size;
 
         g.IO.MetricsRenderVertices += draw_data->TotalVtxCount;
         g.IO.MetricsRenderIndices += draw_data->TotalIdxCount;
@@ -5155,6 +5509,27 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
+
+    // Lookup in cache
+    ImGuiTextSizeCacheEntry* cache_entry = NULL;
+    ImU64 cache_key = 0;
+    int text_len = 0;
+    if (g.IO.ConfigTextSizeCache)
+    {
+        if (text_display_end == NULL)
+            text_display_end = text + strlen(text);
+        text_len = (int)(text_display_end - text);
+        ImU32 sizes[2];
+        memcpy(sizes, &font_size, sizeof(float));
+        memcpy(sizes + 1, &wrap_width, sizeof(float));
+        const ImU64 seed = (ImU64)(size_t)font ^ ((ImU64)font->LookupTablesVersion << 32) ^ (((ImU64)sizes[0] << 32) | sizes[1]) * 0x9E3779B97F4A7C15ULL;
+        cache_key = ImHashData64(text, (size_t)text_len, seed);
+        cache_key = (cache_key != 0) ? cache_key : 1;
+        cache_entry = TextSizeCacheLookup(cache_key, text_len);
+        if (cache_entry->Key == cache_key)
+            return cache_entry->Size;
+    }
+
     ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
 
     // Round
@@ -5164,9 +5539,75 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     // - https://embarkstudios.github.io/rust-gpu/api/src/libm/math/ceilf.rs.html
     text_size.x = IM_FLOOR(text_size.x + 0.99999f);
 
+    if (cache_entry != NULL)
+    {
+        cache_entry->Key = cache_key;
+        cache_entry->TextLen = text_len;
+        cache_entry->Size = text_size;
+    }
     return text_size;
 }
 
+// Return matching entry, or entry to overwrite (least recently used of the set) when Key doesn't match.
+ImGuiTextSizeCacheEntry* ImGui::TextSizeCacheLookup(ImU64 key, int text_len)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTextSizeCache* cache = &g.TextSizeCache;
+    if (cache->Entries.Size == 0)
+        TextSizeCacheResize(cache, 512);
+    ImGuiTextSizeCacheEntry* set = &cache->Entries.Data[((ImU32)key & (ImU32)(cache->Entries.Size / 2 - 1)) * 2];
+    for (int way_n = 0; way_n < 2; way_n++)
+        if (set[way_n].Key == key && set[way_n].TextLen == text_len)
+        {
+            set[way_n].LastUsedFrame = g.FrameCount;
+            cache->HitsCount++;
+            return &set[way_n];
+        }
+    ImGuiTextSizeCacheEntry* entry = (set[0].LastUsedFrame <= set[1].LastUsedFrame) ? &set[0] : &set[1];
+    if (entry->LastUsedFrame == g.FrameCount)
+        cache->EvictionsCount++;
+    entry->Key = 0;
+    entry->LastUsedFrame = g.FrameCount;
+    cache->MissesCount++;
+    return entry;
+}
+
+// Discard all entries. 'entries_count' needs to be a power of two.
+void ImGui::TextSizeCacheResize(ImGuiTextSizeCache* cache, int entries_count)
+{
+    IM_ASSERT(entries_count >= 2 && ImIsPowerOfTwo(entries_count));
+    cache->Entries.resize(entries_count);
+    for (int n = 0; n < cache->Entries.Size; n++)
+    {
+        ImGuiTextSizeCacheEntry* entry = &cache->Entries.Data[n];
+        entry->Key = 0;
+        entry->TextLen = 0;
+        entry->LastUsedFrame = -1;
+        entry->Size = ImVec2(0.0f, 0.0f);
+    }
+}
+
+// Called by NewFrame()
+void ImGui::UpdateTextSizeCache()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTextSizeCache* cache = &g.TextSizeCache;
+    cache->HitsCountLastFrame = cache->HitsCount;
+    cache->MissesCountLastFrame = cache->MissesCount;
+    cache->EvictionsCountLastFrame = cache->EvictionsCount;
+    cache->HitsCount = cache->MissesCount = cache->EvictionsCount = 0;
+    if (!g.IO.ConfigTextSizeCache)
+    {
+        cache->Entries.clear();
+        return;
+    }
+
+    // Grow when labels submitted during last frame didn't fit. A few sets always get more than 2 labels, don't grow for them.
+    const int entries_count_max = 64 * 1024;
+    if (cache->EvictionsCountLastFrame * 32 > cache->HitsCountLastFrame + cache->MissesCountLastFrame && cache->Entries.Size < entries_count_max)
+        TextSizeCacheResize(cache, cache->Entries.Size * 2);
+}
+
 // Find window given position, search front-to-back
 // FIXME: Note that we have an inconsequential lag here: OuterRectClipped is updated in Begin(), so windows moved programmatically
 // with SetWindowPos() and not SetNextWindowPos() will have that rectangle lagging by a frame at the time FindHoveredWindow() is
@@ -5881,6 +6322,8 @@ static bool ImGui::UpdateWindowManualResize(ImGuiWindow* window, const ImVec2& s
         ItemAdd(border_rect, border_id, NULL, ImGuiItemFlags_NoNav);
         ButtonBehavior(border_rect, border_id, &hovered, &held, ImGuiButtonFlags_FlattenChildren | ImGuiButtonFlags_NoNavFocus);
         //GetForegroundDrawLists(window)->AddRect(border_rect.Min, border_rect.Max, IM_COL32(255, 255, 0, 255));
+        if (hovered && g.HoveredIdTimer <= WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER)
+            RequestNextFrame(WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER - g.HoveredIdTimer);
         if ((hovered && g.HoveredIdTimer > WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER) || held)
         {
             g.MouseCursor = (axis == ImGuiAxis_X) ? ImGuiMouseCursor_ResizeEW : ImGuiMouseCursor_ResizeNS;
@@ -6787,11 +7230,14 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->DC.TextWrapPos = -1.0f; // disabled
         window->DC.ItemWidthStack.resize(0);
         window->DC.TextWrapPosStack.resize(0);
+        window->DC.TextWrapLayoutsCount = 0;
 
         if (window->AutoFitFramesX > 0)
             window->AutoFitFramesX--;
         if (window->AutoFitFramesY > 0)
             window->AutoFitFramesY--;
+        if (window->HiddenFramesCanSkipItems > 0 || window->HiddenFramesCannotSkipItems > 0 || window->HiddenFramesForRenderOnly > 0 || window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0)
+            RequestNextFrame(); // Window needs more frames to settle its size
 
         // Apply focus (we need to call FocusWindow() AFTER setting DC.CursorStartPos so our initial navigation reference rectangle can start around there)
         // We ImGuiFocusRequestFlags_UnlessBelowModal to:
@@ -7119,6 +7565,8 @@ void ImGui::SetCurrentFont(ImFont* font)
     ImGuiContext& g = *GImGui;
     IM_ASSERT(font && font->IsLoaded());    // Font Atlas not created. Did you call io.Fonts->GetTexDataAsRGBA32 / GetTexDataAsAlpha8 ?
     IM_ASSERT(font->Scale > 0.0f);
+    if (font->DeferredGlyphs)
+        font->LoadDeferredGlyphs(); // First use of a ImFontConfig::Deferred font
     g.Font = font;
     g.FontBaseSize = ImMax(1.0f, g.IO.FontGlobalScale * g.Font->FontSize * g.Font->Scale);
     g.FontSize = g.CurrentWindow ? g.CurrentWindow->CalcFontSize() : 0.0f;
@@ -7126,6 +7574,7 @@ void ImGui::SetCurrentFont(ImFont* font)
     ImFontAtlas* atlas = g.Font->ContainerAtlas;
     g.DrawListSharedData.TexUvWhitePixel = atlas->TexUvWhitePixel;
     g.DrawListSharedData.TexUvLines = atlas->TexUvLines;
+    g.DrawListSharedData.TexUvRoundCorners = atlas->TexUvRoundCorners;
     g.DrawListSharedData.Font = g.Font;
     g.DrawListSharedData.FontSize = g.FontSize;
 }
@@ -7339,7 +7788,10 @@ bool ImGui::IsWindowHovered(ImGuiHoveredFlags flags)
     if (flags & ImGuiHoveredFlags_ForTooltip)
         flags |= g.Style.HoverFlagsForTooltipMouse;
     if ((flags & ImGuiHoveredFlags_Stationary) != 0 && g.HoverWindowUnlockedStationaryId != ref_window->ID)
+    {
+        RequestNextFrame(g.Style.HoverStationaryDelay - g.MouseStationaryTimer);
         return false;
+    }
 
     return true;
 }
@@ -7846,6 +8298,7 @@ bool ImGui::IsRectVisible(const ImVec2& rect_min, const ImVec2& rect_max)
 // - GetKeyName()
 // - GetKeyChordName() [Internal]
 // - CalcTypematicRepeatAmount() [Internal]
+// - CalcTypematicRepeatNextDelay() [Internal]
 // - GetTypematicRepeatRate() [Internal]
 // - GetKeyPressedAmount() [Internal]
 // - GetKeyMagnitude2d() [Internal]
@@ -8010,6 +8463,16 @@ int ImGui::CalcTypematicRepeatAmount(float t0, float t1, float repeat_delay, flo
     return count;
 }
 
+// Return time until the next repeat of a key held for 't' seconds
+float ImGui::CalcTypematicRepeatNextDelay(float t, float repeat_delay, float repeat_rate)
+{
+    if (t < repeat_delay)
+        return repeat_delay - t;
+    if (repeat_rate <= 0.0f)
+        return FLT_MAX;
+    return repeat_rate - ImFmod(t - repeat_delay, repeat_rate);
+}
+
 void ImGui::GetTypematicRepeatRate(ImGuiInputFlags flags, float* repeat_delay, float* repeat_rate)
 {
     ImGuiContext& g = *GImGui;
@@ -8590,6 +9053,21 @@ static void ImGui::UpdateKeyboardInputs()
         key_data->DownDuration = key_data->Down ? (key_data->DownDuration < 0.0f ? 0.0f : key_data->DownDuration + io.DeltaTime) : -1.0f;
     }
 
+    // Request frames for key repeats of held keys (modifiers don't repeat)
+    for (ImGuiKey key = ImGuiKey_NamedKey_BEGIN; key < ImGuiKey_NamedKey_END; key = (ImGuiKey)(key + 1))
+    {
+        const float t = io.KeysData[key - ImGuiKey_KeysData_OFFSET].DownDuration;
+        if (t < 0.0f || (key >= ImGuiKey_LeftCtrl && key <= ImGuiKey_RightSuper) || (key >= ImGuiKey_ReservedForModCtrl && key <= ImGuiKey_ReservedForModSuper))
+            continue;
+        const ImGuiInputFlags repeat_rates[] = { ImGuiInputFlags_RepeatRateDefault, ImGuiInputFlags_RepeatRateNavMove, ImGuiInputFlags_RepeatRateNavTweak };
+        for (int rate_n = 0; rate_n < IM_ARRAYSIZE(repeat_rates); rate_n++)
+        {
+            float repeat_delay, repeat_rate;
+            GetTypematicRepeatRate(repeat_rates[rate_n], &repeat_delay, &repeat_rate);
+            RequestNextFrame(CalcTypematicRepeatNextDelay(t, repeat_delay, repeat_rate));
+        }
+    }
+
     // Update keys/input owner (named keys only): one entry per key
     for (ImGuiKey key = ImGuiKey_NamedKey_BEGIN; key < ImGuiKey_NamedKey_END; key = (ImGuiKey)(key + 1))
     {
@@ -9198,6 +9676,10 @@ static void ImGui::ErrorCheckNewFrameSanityChecks()
     IM_ASSERT((g.FrameCount == 0 || g.FrameCountEnded == g.FrameCount)  && "Forgot to call Render() or EndFrame() at the end of the previous frame?");
     IM_ASSERT(g.IO.DisplaySize.x >= 0.0f && g.IO.DisplaySize.y >= 0.0f  && "Invalid DisplaySize value!");
     IM_ASSERT(g.IO.Fonts->IsBuilt()                                     && "Font Atlas not built! Make sure you called ImGui_ImplXXXX_NewFrame() function for renderer backend, which should call io.Fonts->GetTexDataAsRGBA32() / GetTexDataAsAlpha8()");
+    IM_ASSERT((g.IO.Fonts->FontBuilderData == NULL || (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTexUpdates)) && "ImFontAtlasFlags_DynamicGlyphs requires a renderer backend supporting ImGuiBackendFlags_RendererHasTexUpdates!");
+    IM_ASSERT((g.IO.Fonts->GetTexPageCount() == 1 || (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTexPages)) && "Font atlas has multiple texture pages (see ImFontAtlas::TexMaxHeight): requires a renderer backend supporting ImGuiBackendFlags_RendererHasTexPages!");
+    for (int page_n = 1; page_n < g.IO.Fonts->GetTexPageCount(); page_n++)
+        IM_ASSERT((!g.IO.Fonts->IsTexPageSDF(page_n) || (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasSDF)) && "ImFontConfig::SDF requires a renderer backend supporting ImGuiBackendFlags_RendererHasSDF!");
     IM_ASSERT(g.Style.CurveTessellationTol > 0.0f                       && "Invalid style setting!");
     IM_ASSERT(g.Style.CircleTessellationMaxError > 0.0f                 && "Invalid style setting!");
     IM_ASSERT(g.Style.Alpha >= 0.0f && g.Style.Alpha <= 1.0f            && "Invalid style setting!"); // Allows us to avoid a few clamps in color computations
@@ -13653,14 +14135,27 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
         DebugNodeFont(font);
         PopID();
     }
-    if (TreeNode("Font Atlas", "Font Atlas (%dx%d pixels)", atlas->TexWidth, atlas->TexHeight))
+    // Occupancy: area used by glyphs (including padding) and custom rectangles, compared to the area of all texture pages
+    int used_surface = 0;
+    for (int i = 0; i < atlas->Fonts.Size; i++)
+        used_surface += atlas->Fonts[i]->MetricsTotalSurface;
+    for (int i = 0; i < atlas->CustomRects.Size; i++)
+        if (atlas->CustomRects[i].IsPacked() && atlas->CustomRects[i].Font == NULL) // Glyphs added with AddCustomRectFontGlyph() are already counted by their font
+            used_surface += atlas->CustomRects[i].Width * atlas->CustomRects[i].Height;
+    const int tex_surface = atlas->TexWidth * atlas->TexHeight * atlas->GetTexPageCount();
+    if (TreeNode("Font Atlas", "Font Atlas (%dx%d pixels, %d pages, %.1f%% used)", atlas->TexWidth, atlas->TexHeight, atlas->GetTexPageCount(), (tex_surface > 0) ? used_surface * 100.0f / tex_surface : 0.0f))
     {
         ImGuiContext& g = *GImGui;
         ImGuiMetricsConfig* cfg = &g.DebugMetricsConfig;
         Checkbox("Tint with Text Color", &cfg->ShowAtlasTintedWithTextColor); // Using text color ensure visibility of core atlas data, but will alter custom colored icons
         ImVec4 tint_col = cfg->ShowAtlasTintedWithTextColor ? GetStyleColorVec4(ImGuiCol_Text) : ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
         ImVec4 border_col = GetStyleColorVec4(ImGuiCol_Border);
-        Image(atlas->TexID, ImVec2((float)atlas->TexWidth, (float)atlas->TexHeight), ImVec2(0.0f, 0.0f), ImVec2(1.0f, 1.0f), tint_col, border_col);
+        for (int page_n = 0; page_n < atlas->GetTexPageCount(); page_n++)
+        {
+            if (page_n > 0)
+                Text("Page %d:%s", page_n, atlas->IsTexPageSDF(page_n) ? " (SDF)" : "");
+            Image(atlas->GetTexPageID(page_n), ImVec2((float)atlas->TexWidth, (float)atlas->TexHeight), ImVec2(0.0f, 0.0f), ImVec2(1.0f, 1.0f), tint_col, border_col);
+        }
         TreePop();
     }
 }
@@ -13686,6 +14181,16 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
     Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
     Text("%d visible windows, %d active allocations", io.MetricsRenderWindows, io.MetricsActiveAllocations);
+    if (io.ConfigDrawDataMergeLists)
+        Text("%d draw commands (%d before merging draw lists)", g.RenderDrawCmdsCount, g.RenderDrawCmdsCountBeforeMerge);
+    else
+        Text("%d draw commands", g.RenderDrawCmdsCount);
+    if (io.ConfigTextSizeCache)
+    {
+        const ImGuiTextSizeCache* cache = &g.TextSizeCache;
+        const int lookups_count = cache->HitsCountLastFrame + cache->MissesCountLastFrame;
+        Text("Text size cache: %d/%d hits (%.1f%%), %d evictions, %d entries", cache->HitsCountLastFrame, lookups_count, lookups_count ? cache->HitsCountLastFrame * 100.0f / lookups_count : 0.0f, cache->EvictionsCountLastFrame, cache->Entries.Size);
+    }
     //SameLine(); if (SmallButton("GC")) { g.GcCompactAll = true; }
 
     Separator();
@@ -14213,7 +14718,9 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
     int cmd_count = draw_list->CmdBuffer.Size;
     if (cmd_count > 0 && draw_list->CmdBuffer.back().ElemCount == 0 && draw_list->CmdBuffer.back().UserCallback == NULL)
         cmd_count--;
-    bool node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, cmd_count);
+    bool node_open = draw_list->ShapeBuffer.Size > 0 ?
+        TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d shapes, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, draw_list->ShapeBuffer.Size, cmd_count) :
+        TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, cmd_count);
     if (draw_list == GetWindowDrawList())
     {
         SameLine();
@@ -14244,6 +14751,8 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
         ImFormatString(buf, IM_ARRAYSIZE(buf), "DrawCmd:%5d tris, Tex 0x%p, ClipRect (%4.0f,%4.0f)-(%4.0f,%4.0f)",
             pcmd->ElemCount / 3, (void*)(intptr_t)pcmd->TextureId,
             pcmd->ClipRect.x, pcmd->ClipRect.y, pcmd->ClipRect.z, pcmd->ClipRect.w);
+        if (pcmd->ShapeCount > 0)
+            ImFormatString(buf + strlen(buf), IM_ARRAYSIZE(buf) - strlen(buf), ", %d shapes", pcmd->ShapeCount);
         bool pcmd_node_open = TreeNode((void*)(pcmd - draw_list->CmdBuffer.begin()), "%s", buf);
         if (IsItemHovered() && (cfg->ShowDrawCmdMesh || cfg->ShowDrawCmdBoundingBoxes) && fg_draw_list)
             DebugNodeDrawCmdShowMeshAndBoundingBox(fg_draw_list, draw_list, pcmd, cfg->ShowDrawCmdMesh, cfg->ShowDrawCmdBoundingBoxes);
@@ -14268,6 +14777,8 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
         Selectable(buf);
         if (IsItemHovered() && fg_draw_list)
             DebugNodeDrawCmdShowMeshAndBoundingBox(fg_draw_list, draw_list, pcmd, true, false);
+        if (pcmd->ShapeCount > 0)
+            BulletText("Shapes: ShapeCount: %d, ShapeOffset: +%d", pcmd->ShapeCount, pcmd->ShapeOffset);
 
         // Display individual triangles/vertices. Hover on to get the corresponding triangle highlighted.
         ImGuiListClipper clipper;
@@ -14280,9 +14791,10 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
                 for (int n = 0; n < 3; n++, idx_i++)
                 {
                     const ImDrawVert& v = vtx_buffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
+                    const ImVec2 uv = v.uv;
                     triangle[n] = v.pos;
                     buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
-                        (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
+                        (n == 0) ? "Vert:" : "     ", idx_i, triangle[n].x, triangle[n].y, uv.x, uv.y, v.col);
                 }
 
                 Selectable(buf, false);
@@ -14329,6 +14841,15 @@ void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList* out_draw_list, co
     out_draw_list->Flags = backup_flags;
 }
 
+// Same as FindGlyphNoFallback() but doesn't rasterize glyphs on demand (ImFontAtlasFlags_DynamicGlyphs), so browsing doesn't fill the atlas.
+static const ImFontGlyph* DebugFindLoadedGlyph(ImFont* font, ImWchar c)
+{
+    const ImWchar i = font->GetIndexLookup(c);
+    if (i >= IM_FONTGLYPH_INDEX_NOT_LOADED)
+        return NULL;
+    return &font->Glyphs.Data[i];
+}
+
 // [DEBUG] Display details for a single font, called by ShowStyleEditor().
 void ImGui::DebugNodeFont(ImFont* font)
 {
@@ -14360,11 +14881,12 @@ void ImGui::DebugNodeFont(ImFont* font)
     Text("Ellipsis character: '%s' (U+%04X)", ImTextCharToUtf8(c_str, font->EllipsisChar), font->EllipsisChar);
     const int surface_sqrt = (int)ImSqrt((float)font->MetricsTotalSurface);
     Text("Texture Area: about %d px ~%dx%d px", font->MetricsTotalSurface, surface_sqrt, surface_sqrt);
+    Text("Lookup tables: %d pages of %d code-points, %d bytes", font->IndexPages.Size, IM_FONT_INDEX_PAGE_SIZE, (int)(font->IndexPages.size_in_bytes() + font->IndexPageMap.size_in_bytes()));
     for (int config_i = 0; config_i < font->ConfigDataCount; config_i++)
         if (font->ConfigData)
             if (const ImFontConfig* cfg = &font->ConfigData[config_i])
-                BulletText("Input %d: \'%s\', Oversample: (%d,%d), PixelSnapH: %d, Offset: (%.1f,%.1f)",
-                    config_i, cfg->Name, cfg->OversampleH, cfg->OversampleV, cfg->PixelSnapH, cfg->GlyphOffset.x, cfg->GlyphOffset.y);
+                BulletText("Input %d: \'%s\', Oversample: (%d,%d), PixelSnapH: %d, Offset: (%.1f,%.1f), SDF: %d",
+                    config_i, cfg->Name, cfg->OversampleH, cfg->OversampleV, cfg->PixelSnapH, cfg->GlyphOffset.x, cfg->GlyphOffset.y, cfg->SDF);
 
     // Display all glyphs of the fonts in separate pages of 256 characters
     if (TreeNode("Glyphs", "Glyphs (%d)", font->Glyphs.Size))
@@ -14386,7 +14908,7 @@ void ImGui::DebugNodeFont(ImFont* font)
 
             int count = 0;
             for (unsigned int n = 0; n < 256; n++)
-                if (font->FindGlyphNoFallback((ImWchar)(base + n)))
+                if (DebugFindLoadedGlyph(font, (ImWchar)(base + n)))
                     count++;
             if (count <= 0)
                 continue;
@@ -14401,7 +14923,7 @@ void ImGui::DebugNodeFont(ImFont* font)
                 // available here and thus cannot easily generate a zero-terminated UTF-8 encoded string.
                 ImVec2 cell_p1(base_pos.x + (n % 16) * (cell_size + cell_spacing), base_pos.y + (n / 16) * (cell_size + cell_spacing));
                 ImVec2 cell_p2(cell_p1.x + cell_size, cell_p1.y + cell_size);
-                const ImFontGlyph* glyph = font->FindGlyphNoFallback((ImWchar)(base + n));
+                const ImFontGlyph* glyph = DebugFindLoadedGlyph(font, (ImWchar)(base + n));
                 draw_list->AddRect(cell_p1, cell_p2, glyph ? IM_COL32(255, 255, 255, 100) : IM_COL32(255, 255, 255, 50));
                 if (!glyph)
                     continue;
@@ -14425,6 +14947,7 @@ void ImGui::DebugNodeFontGlyph(ImFont*, const ImFontGlyph* glyph)
     Text("Codepoint: U+%04X", glyph->Codepoint);
     Separator();
     Text("Visible: %d", glyph->Visible);
+    Text("TexPage: %d", glyph->TexPage);
     Text("AdvanceX: %.1f", glyph->AdvanceX);
     Text("Pos: (%.2f,%.2f)->(%.2f,%.2f)", glyph->X0, glyph->Y0, glyph->X1, glyph->Y1);
     Text("UV: (%.3f,%.3f)->(%.3f,%.3f)", glyph->U0, glyph->V0, glyph->U1, glyph->V1);
@@ -14497,6 +15020,10 @@ void ImGui::DebugNodeViewport(ImGuiViewportP* viewport)
             (flags & ImGuiViewportFlags_IsPlatformWindow)  ? " IsPlatformWindow"  : "",
             (flags & ImGuiViewportFlags_IsPlatformMonitor) ? " IsPlatformMonitor" : "",
             (flags & ImGuiViewportFlags_OwnedByApp)        ? " OwnedByApp"        : "");
+        ImDrawData* draw_data = &viewport->DrawDataP;
+        ImVec4 dirty_bb = draw_data->GetDirtyRectsBounds();
+        BulletText("DirtyRects: %d, Bounds: (%.0f,%.0f)-(%.0f,%.0f)", draw_data->DirtyRects.Size, dirty_bb.x, dirty_bb.y, dirty_bb.z, dirty_bb.w);
+        BulletText("Fingerprint: 0x%08X%08X%s", (ImU32)(draw_data->Fingerprint >> 32), (ImU32)draw_data->Fingerprint, draw_data->Unchanged ? " (Unchanged)" : "");
         for (int draw_list_i = 0; draw_list_i < viewport->DrawDataP.CmdLists.Size; draw_list_i++)
             DebugNodeDrawList(NULL, viewport, viewport->DrawDataP.CmdLists[draw_list_i], "DrawList");
         TreePop();
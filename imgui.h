@@ -142,13 +142,16 @@ struct ImDrawData;                  // All draw command lists required to render
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
-struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawShape;                 // A single shape instance (rectangle, rounded rectangle or circle, filled or outlined), see ImDrawListFlags_ShapeInstances
+struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default, 12 bytes with IMGUI_USE_COMPACT_DRAWVERT. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
+struct ImFontAtlasTexPage;          // Additional texture page of a font atlas (see ImFontAtlas::TexMaxHeight)
 struct ImFontBuilderIO;             // Opaque interface to a font builder (stb_truetype or FreeType).
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
+struct ImFontIndexPage;             // Lookup tables of a font for one block of 256 code points (see ImFont::IndexPages)
 struct ImColor;                     // Helper functions to create a color that can be converted to either u32 or float4 (*OBSOLETE* please avoid using)
 struct ImGuiContext;                // Dear ImGui context (opaque structure, unless including imgui_internal.h)
 struct ImGuiIO;                     // Main configuration and I/O between your application and ImGui
@@ -886,6 +889,7 @@ namespace ImGui
     IMGUI_API bool          IsRectVisible(const ImVec2& rect_min, const ImVec2& rect_max);      // test if rectangle (in screen space) is visible / not clipped. to perform coarse clipping on user's side.
     IMGUI_API double        GetTime();                                                          // get global imgui time. incremented by io.DeltaTime every frame.
     IMGUI_API int           GetFrameCount();                                                    // get global imgui frame count. incremented by 1 every frame.
+    IMGUI_API void          RequestNextFrame(float delay = 0.0f);                               // request a new frame within 'delay' seconds even if no input event is received, e.g. for your own animations. updates io.NextFrameDeadline, reset every frame.
     IMGUI_API ImDrawListSharedData* GetDrawListSharedData();                                    // you may use this when creating your own ImDrawList instances.
     IMGUI_API const char*   GetStyleColorName(ImGuiCol idx);                                    // get a string corresponding to the enum value (for display, saving, etc.).
     IMGUI_API void          SetStateStorage(ImGuiStorage* storage);                             // replace current window storage with our own (if you want to manipulate it yourself, typically clear subsection of it)
@@ -1553,6 +1557,10 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasMouseCursors       = 1 << 1,   // Backend Platform supports honoring GetMouseCursor() value to change the OS cursor shape.
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if ImGuiConfigFlags_NavEnableSetMousePos is set).
     ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasShapes     = 1 << 4,   // Backend Renderer supports ImDrawCmd::ShapeOffset/ShapeCount and ImDrawList::ShapeBuffer. This allows draw lists with ImDrawListFlags_ShapeInstances to output shapes without triangulating them.
+    ImGuiBackendFlags_RendererHasTexUpdates = 1 << 5,   // Backend Renderer supports uploading ImFontAtlas::TexDirtyRects[] into its existing font texture. Required by ImFontAtlasFlags_DynamicGlyphs.
+    ImGuiBackendFlags_RendererHasTexPages   = 1 << 6,   // Backend Renderer creates one texture per ImFontAtlas texture page (see ImFontAtlas::GetTexPageCount(), SetTexPageID()). Required when glyphs don't fit in ImFontAtlas::TexMaxHeight.
+    ImGuiBackendFlags_RendererHasSDF        = 1 << 7,   // Backend Renderer draws textures of ImFontAtlas pages flagged with ImFontAtlasTexPage::SDF with a distance field shader. Required by ImFontConfig::SDF (along with ImGuiBackendFlags_RendererHasTexPages).
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -1925,6 +1933,7 @@ struct ImGuiStyle
     bool        AntiAliasedLines;           // Enable anti-aliased lines/borders. Disable if you are really tight on CPU/GPU. Latched at the beginning of the frame (copied to ImDrawList).
     bool        AntiAliasedLinesUseTex;     // Enable anti-aliased lines/borders using textures where possible. Require backend to render with bilinear filtering (NOT point/nearest filtering). Latched at the beginning of the frame (copied to ImDrawList).
     bool        AntiAliasedFill;            // Enable anti-aliased edges around filled shapes (rounded rectangles, circles, etc.). Disable if you are really tight on CPU/GPU. Latched at the beginning of the frame (copied to ImDrawList).
+    bool        AntiAliasedFillUseTex;      // Enable anti-aliased filled circles and rounded rectangles using textures where possible. Require backend to render with bilinear filtering (NOT point/nearest filtering). Latched at the beginning of the frame (copied to ImDrawList).
     float       CurveTessellationTol;       // Tessellation tolerance when using PathBezierCurveTo() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
     float       CircleTessellationMaxError; // Maximum error (in pixels) allowed when using AddCircle()/AddCircleFilled() or drawing rounded corner rectangles with no explicit segment count specified. Decrease for higher quality but more geometry.
     ImVec4      Colors[ImGuiCol_COUNT];
@@ -1989,6 +1998,10 @@ struct ImGuiIO
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // Enable allowing to move windows only when clicking on their title bar. Does not apply to windows without a title bar.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    bool        ConfigDrawDataDirtyRects;       // = false          // [BETA] Compare draw lists contents with the previous frame in Render() and output the screen rectangles which changed in ImDrawData::DirtyRects, allowing partial redraw/present. When disabled, DirtyRects is left empty: redraw everything.
+    bool        ConfigDrawDataFingerprint;      // = false          // [BETA] Hash draw lists contents in Render() and set ImDrawData::Unchanged when identical to the previous frame, allowing the application to skip rendering and presenting entirely.
+    bool        ConfigDrawDataMergeLists;       // = false          // [BETA] Merge consecutive draw lists of ImDrawData in Render(), joining compatible draw commands across windows to reduce draw calls. ImDrawData::CmdLists[] then contains draw lists owned by Dear ImGui instead of the windows draw lists. Draw lists with user callbacks are left untouched.
+    bool        ConfigTextSizeCache;            // = false          // [BETA] Cache results of CalcTextSize() across frames, keyed by font, font size, wrap width and text hash. Saves measuring the same labels every frame. See Metrics/Debugger window for hit rate.
 
     // Inputs Behaviors
     // (other variables, ones which are expected to be tweaked within UI code, are exposed in ImGuiStyle)
@@ -2087,6 +2100,7 @@ struct ImGuiIO
     int         MetricsRenderWindows;               // Number of visible windows
     int         MetricsActiveWindows;               // Number of active windows
     int         MetricsActiveAllocations;           // Number of active allocations, updated by MemAlloc/MemFree based on current context. May be off if you have multiple imgui contexts.
+    double      NextFrameDeadline;                  // Time (in ImGui::GetTime() timeline) at which Dear ImGui needs a new frame even if no input event is received, to update time-driven state (text cursor blinking, tooltip delays, key repeat, fades, .ini saving...). == GetTime() if a new frame is needed immediately, FLT_MAX if none. Updated during the frame, read it after Render(). Applications may wait for input events until then, e.g. ImGui_ImplGlfw_WaitForEvents(), ImGui_ImplSDL2_WaitForEvent().
     ImVec2      MouseDelta;                         // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
 
     // Legacy: before 1.87, we required backend to fill io.KeyMap[] (imgui->native map) during initialization and io.KeysDown[] (native indices) every frame.
@@ -2491,6 +2505,11 @@ struct ImColor
 #define IM_DRAWLIST_TEX_LINES_WIDTH_MAX     (63)
 #endif
 
+// The maximum radius of anti-aliased filled circles and rounded corners to bake textures for, in 0.5 pixel steps. Build atlas with ImFontAtlasFlags_NoBakedRoundCorners to disable baking.
+#ifndef IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX
+#define IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX    (16)
+#endif
+
 // ImDrawCallback: Draw callbacks for advanced uses [configurable type: override in imconfig.h]
 // NB: You most likely do NOT need to use draw callbacks just to create your own widget or customized UI rendering,
 // you can poke into the draw list for that! Draw callback may be useful for example to:
@@ -2512,6 +2531,9 @@ typedef void (*ImDrawCallback)(const ImDrawList* parent_list, const ImDrawCmd* c
 // - VtxOffset: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset' is enabled,
 //   this fields allow us to render meshes larger than 64K vertices while keeping 16-bit indices.
 //   Backends made for <1.71. will typically ignore the VtxOffset fields.
+// - ShapeCount: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasShapes' is enabled, a command may carry shape instances
+//   (stored in the callee ImDrawList's ShapeBuffer[]), to be rendered after the command's triangles, using the same clipping rectangle.
+//   Backends not setting the flag will never see ShapeCount > 0.
 // - The ClipRect/TextureId/VtxOffset fields must be contiguous as we memcmp() them together (this is asserted for).
 struct ImDrawCmd
 {
@@ -2522,6 +2544,8 @@ struct ImDrawCmd
     unsigned int    ElemCount;          // 4    // Number of indices (multiple of 3) to be rendered as triangles. Vertices are stored in the callee ImDrawList's vtx_buffer[] array, indices in idx_buffer[].
     ImDrawCallback  UserCallback;       // 4-8  // If != NULL, call the function instead of rendering the vertices. clip_rect and texture_id will be set normally.
     void*           UserCallbackData;   // 4-8  // The draw callback code can access this.
+    unsigned int    ShapeOffset;        // 4    // Start offset in shape buffer.
+    unsigned int    ShapeCount;         // 4    // Number of shape instances to be rendered after the triangles. Always 0 unless ImGuiBackendFlags_RendererHasShapes is set.
 
     ImDrawCmd() { memset(this, 0, sizeof(*this)); } // Also ensure our padding fields are zeroed
 
@@ -2529,14 +2553,56 @@ struct ImDrawCmd
     inline ImTextureID GetTexID() const { return TextureId; }
 };
 
+// Shape instance, see ImDrawListFlags_ShapeInstances
+// - Rendered by the backend as an anti-aliased rounded rectangle: coverage is evaluated from the signed distance to the shape edge.
+// - Outlined shapes (Thickness > 0.0f) are stroked along the edge, with half the thickness on each side.
+// - Circles are stored as square with Rounding == half size.
+struct ImDrawShape
+{
+    ImVec2  Min, Max;       // 8+8  // Rectangle (for outlined shapes: center of the stroke)
+    float   Rounding;       // 4    // Corner radius, applied to all corners
+    float   Thickness;      // 4    // Outline thickness, 0.0f for filled shapes
+    ImU32   Col;            // 4
+};
+
 // Vertex layout
-#ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#if !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT) && !defined(IMGUI_USE_COMPACT_DRAWVERT)
 struct ImDrawVert
 {
     ImVec2  pos;
     ImVec2  uv;
     ImU32   col;
 };
+#elif !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+// Compact vertex layout (12 bytes instead of 20 bytes), enabled by defining IMGUI_USE_COMPACT_DRAWVERT in imconfig.h
+// - pos: 2x signed 16-bit fixed point, IM_DRAWVERT_POS_ONE units per pixel. Default to 4: 0.25 pixel precision, positions must be within [-8192,+8192).
+// - uv:  2x unsigned normalized 16-bit.
+// - col: unchanged.
+// Components convert from/to float on access, so ImDrawList code writes this layout natively. Positions are absolute like with the default layout.
+// Your renderer backend needs to support it: currently imgui_impl_opengl3.cpp and imgui_impl_vulkan.cpp.
+#ifndef IM_DRAWVERT_POS_ONE
+#define IM_DRAWVERT_POS_ONE     4
+#endif
+template<typename T, int ONE, int MIN, int MAX>
+struct ImDrawVertFixed
+{
+    T                   Value;
+    operator            float() const                   { return (float)Value * (1.0f / ONE); }
+    ImDrawVertFixed&    operator=(float f)              { f *= ONE; f = (f < (float)MIN) ? (float)MIN : (f > (float)MAX) ? (float)MAX : f; Value = (T)(f < 0.0f ? f - 0.5f : f + 0.5f); return *this; }
+};
+template<typename T, int ONE, int MIN, int MAX>
+struct ImDrawVertFixed2
+{
+    ImDrawVertFixed<T, ONE, MIN, MAX> x, y;
+    operator            ImVec2() const                  { return ImVec2(x, y); }
+    ImDrawVertFixed2&   operator=(const ImVec2& v)      { x = v.x; y = v.y; return *this; }
+};
+struct ImDrawVert
+{
+    ImDrawVertFixed2<ImS16, IM_DRAWVERT_POS_ONE, -32768, 32767> pos;
+    ImDrawVertFixed2<ImU16, 65535, 0, 65535>                    uv;
+    ImU32                                                       col;
+};
 #else
 // You can override the vertex format layout by defining IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT in imconfig.h
 // The code expect ImVec2 pos (8 bytes), ImVec2 uv (8 bytes), ImU32 col (4 bytes), but you can re-order them or add other fields as needed to simplify integration in your engine.
@@ -2607,6 +2673,11 @@ enum ImDrawListFlags_
     ImDrawListFlags_AntiAliasedLinesUseTex  = 1 << 1,  // Enable anti-aliased lines/borders using textures when possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
     ImDrawListFlags_AntiAliasedFill         = 1 << 2,  // Enable anti-aliased edge around filled shapes (rounded rectangles, circles).
     ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_JoinedLines             = 1 << 4,  // Non anti-aliased lines/borders share vertices between consecutive segments and have mitered joints (2 vertices per point instead of 4 per segment). Not set by default.
+    ImDrawListFlags_AntiAliasedFillUseTex   = 1 << 5,  // Enable anti-aliased filled circles and rounded rectangles using textures when possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
+    ImDrawListFlags_ShapeInstances          = 1 << 6,  // AddRect(), AddRectFilled(), AddCircle(), AddCircleFilled() output ImDrawShape instances into ShapeBuffer instead of triangles, when 'ImGuiBackendFlags_RendererHasShapes' is enabled. Only for all/none rounded corners and automatic circle segment count. Not set by default.
+    ImDrawListFlags_AllowShapes             = 1 << 7,  // Can emit 'ShapeCount > 0'. Set when 'ImGuiBackendFlags_RendererHasShapes' is enabled.
+    ImDrawListFlags_NoCoarseClip            = 1 << 8,  // Disable CPU-side rejection of primitives whose bounding box is entirely outside the current clip rectangle (rejection is enabled by default).
 };
 
 // Draw command list
@@ -2625,6 +2696,7 @@ struct ImDrawList
     ImVector<ImDrawIdx>     IdxBuffer;          // Index buffer. Each command consume ImDrawCmd::ElemCount of those
     ImVector<ImDrawVert>    VtxBuffer;          // Vertex buffer.
     ImDrawListFlags         Flags;              // Flags, you may poke into these to adjust anti-aliasing settings per-primitive.
+    ImVector<ImDrawShape>   ShapeBuffer;        // Shape instances, see ImDrawListFlags_ShapeInstances. Each command consume ImDrawCmd::ShapeCount of those
 
     // [Internal, used while building lists]
     unsigned int            _VtxCurrentIdx;     // [Internal] generally == VtxBuffer.Size unless we are past 64K vertices, in which case this gets reset to 0.
@@ -2638,6 +2710,7 @@ struct ImDrawList
     ImDrawCmdHeader         _CmdHeader;         // [Internal] template of active commands. Fields should match those of CmdBuffer.back().
     ImDrawListSplitter      _Splitter;          // [Internal] for channels api (note: prefer using your own persistent instance of ImDrawListSplitter!)
     float                   _FringeScale;       // [Internal] anti-alias fringe is scaled by this value, this helps to keep things sharp while zooming at vertex buffer content
+    unsigned int            _ResetStamp;        // [Internal] unique value set by _ResetForNewFrame() (0 = unknown), so Render() can reuse hashes of lists kept across frames (io.ConfigDrawDataDirtyRects, io.ConfigDrawDataFingerprint)
 
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData() or create and use your own ImDrawListSharedData (so you can use ImDrawList without ImGui)
     ImDrawList(ImDrawListSharedData* shared_data) { memset(this, 0, sizeof(*this)); _Data = shared_data; }
@@ -2737,6 +2810,11 @@ struct ImDrawList
     IMGUI_API void  _OnChangedClipRect();
     IMGUI_API void  _OnChangedTextureID();
     IMGUI_API void  _OnChangedVtxOffset();
+    IMGUI_API void  _AddShape(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, float rounding, float thickness);
+    IMGUI_API void  _AddPolyline(const ImVec2* points, int num_points, ImU32 col, ImDrawFlags flags, float thickness);        // No coarse clipping: caller already clipped the whole shape
+    IMGUI_API void  _AddConvexPolyFilled(const ImVec2* points, int num_points, ImU32 col);                                  // No coarse clipping: caller already clipped the whole shape
+    inline    void  _PathStroke(ImU32 col, ImDrawFlags flags, float thickness)  { _AddPolyline(_Path.Data, _Path.Size, col, flags, thickness); _Path.Size = 0; }
+    inline    void  _PathFillConvex(ImU32 col)                                  { _AddConvexPolyFilled(_Path.Data, _Path.Size, col); _Path.Size = 0; }
     IMGUI_API int   _CalcCircleAutoSegmentCount(float radius) const;
     IMGUI_API void  _PathArcToFastEx(const ImVec2& center, float radius, int a_min_sample, int a_max_sample, int a_step);
     IMGUI_API void  _PathArcToN(const ImVec2& center, float radius, float a_min, float a_max, int num_segments);
@@ -2751,18 +2829,23 @@ struct ImDrawData
     int                 CmdListsCount;      // Number of ImDrawList* to render (should always be == CmdLists.size)
     int                 TotalIdxCount;      // For convenience, sum of all ImDrawList's IdxBuffer.Size
     int                 TotalVtxCount;      // For convenience, sum of all ImDrawList's VtxBuffer.Size
+    int                 TotalShapeCount;    // For convenience, sum of all ImDrawList's ShapeBuffer.Size
     ImVector<ImDrawList*> CmdLists;         // Array of ImDrawList* to render. The ImDrawLists are owned by ImGuiContext and only pointed to from here.
     ImVec2              DisplayPos;         // Top-left position of the viewport to render (== top-left of the orthogonal projection matrix to use) (== GetMainViewport()->Pos for the main viewport, == (0.0) in most single-viewport applications)
     ImVec2              DisplaySize;        // Size of the viewport to render (== GetMainViewport()->Size for the main viewport, == io.DisplaySize in most single-viewport applications)
     ImVec2              FramebufferScale;   // Amount of pixels for each unit of DisplaySize. Based on io.DisplayFramebufferScale. Generally (1,1) on normal display, (2,2) on OSX with Retina display.
     ImGuiViewport*      OwnerViewport;      // Viewport carrying the ImDrawData instance, might be of use to the renderer (generally not).
+    ImU64               Fingerprint;        // Hash of all draw lists contents and display settings. Computed when io.ConfigDrawDataFingerprint is set. 0 when not computed (e.g. sizes changed since previous frame, so contents can't be unchanged).
+    bool                Unchanged;          // Contents are identical to the previous frame: the application may skip rendering and presenting. Only set when io.ConfigDrawDataFingerprint is set. Never set with user callbacks. Changes of textures contents are not detected. Draw lists you keep across frames are only hashed again when reset or resized: don't modify their buffers in place.
+    ImVector<ImVec4>    DirtyRects;         // Screen rectangles (x1, y1, x2, y2, same coordinates as ImDrawCmd::ClipRect, rounded to integers) which contents changed since the previous frame, and only need to be redrawn/presented. Only computed when io.ConfigDrawDataDirtyRects is set, otherwise always empty (check io.ConfigDrawDataDirtyRects before relying on it). Empty when nothing changed. Changes of textures contents are not detected.
 
     // Functions
     ImDrawData()    { Clear(); }
     IMGUI_API void  Clear();
     IMGUI_API void  AddDrawList(ImDrawList* draw_list);     // Helper to add an external draw list into an existing ImDrawData.
     IMGUI_API void  DeIndexAllBuffers();                    // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
-    IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
+    IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd (and DirtyRects). Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
+    IMGUI_API ImVec4 GetDirtyRectsBounds() const;           // Helper to calculate the union of DirtyRects. Returns an empty rectangle (0,0,0,0) when nothing changed.
 };
 
 //-----------------------------------------------------------------------------
@@ -2788,10 +2871,14 @@ struct ImFontConfig
     unsigned int    FontBuilderFlags;       // 0        // Settings for custom font builder. THIS IS BUILDER IMPLEMENTATION DEPENDENT. Leave as zero if unsure.
     float           RasterizerMultiply;     // 1.0f     // Brighten (>1.0f) or darken (<1.0f) font output. Brightening small fonts may be a good workaround to make them more readable.
     ImWchar         EllipsisChar;           // -1       // Explicitly specify unicode codepoint of ellipsis character. When fonts are being merged first specified ellipsis will be used.
+    bool            SDF;                    // false    // Rasterize glyphs as signed distance fields into dedicated texture pages, so text stays crisp when scaled (e.g. SetWindowFontScale(), high DPI). Requires a backend with ImGuiBackendFlags_RendererHasSDF. stb_truetype builder only: ignored by imgui_freetype. Not supported with ImFontAtlasFlags_DynamicGlyphs. OversampleH/V and RasterizerMultiply are ignored.
+    int             SDFPadding;             // 4        // Distance in pixels encoded on each side of glyph edges when SDF is enabled. Larger values make larger glyph rectangles.
+    bool            Deferred;               // false    // Don't rasterize any glyph during Build(): they are rasterized into free atlas space the first time the font is used (PushFont(), ImDrawList::AddText()), saving startup time and texture space for rarely used fonts. Requires ImFontAtlasFlags_DynamicGlyphs (ignored otherwise). Merged sources follow the font they are merged into. Not supported with SDF.
 
     // [Internal]
     char            Name[40];               // Name (strictly to ease debugging)
     ImFont*         DstFont;
+    void*           FontDataFile;           // Set when FontData is a read-only mapping of this file (AddFontFromFileTTF() with ImFontAtlasFlags_MapFontFiles). The file stays open: the mapping is released after Build() (FontData == NULL) and mapped again from it when needed.
 
     IMGUI_API ImFontConfig();
 };
@@ -2802,12 +2889,22 @@ struct ImFontGlyph
 {
     unsigned int    Colored : 1;        // Flag to indicate glyph is colored and should generally ignore tinting (make it usable with no shift on little-endian as this is used in loops)
     unsigned int    Visible : 1;        // Flag to indicate glyph has no visible pixels (e.g. space). Allow early out when rendering.
-    unsigned int    Codepoint : 30;     // 0x0000..0x10FFFF
+    unsigned int    TexPage : 8;        // Texture page holding the glyph pixels (0 unless atlas was built with ImFontAtlas::TexMaxHeight or ImFontConfig::SDF)
+    unsigned int    Codepoint : 22;     // 0x0000..0x10FFFF
     float           AdvanceX;           // Distance to next character (= data from font + ImFontConfig::GlyphExtraSpacing.x baked in)
     float           X0, Y0, X1, Y1;     // Glyph corners
     float           U0, V0, U1, V1;     // Texture coordinates
 };
 
+// Lookup tables of a font for one block of IM_FONT_INDEX_PAGE_SIZE code points.
+// Pages are only allocated for blocks which have glyphs, so a font merging e.g. emojis around U+1F600 doesn't need tables for the whole range below.
+#define IM_FONT_INDEX_PAGE_SIZE     256
+struct ImFontIndexPage
+{
+    float           AdvanceX[IM_FONT_INDEX_PAGE_SIZE];  // Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this this info, and are often bottleneck in large UI).
+    ImWchar         Lookup[IM_FONT_INDEX_PAGE_SIZE];    // Index in Glyphs[]. (ImWchar)-1 when there is no glyph.
+};
+
 // Helper to build glyph ranges from text/string data. Feed your application strings/characters to it then call BuildRanges().
 // This is essentially a tightly packed of vector of 64k booleans = 8KB storage.
 struct ImFontGlyphRangesBuilder
@@ -2837,6 +2934,22 @@ struct ImFontAtlasCustomRect
     bool IsPacked() const           { return X != 0xFFFF; }
 };
 
+// Region of the atlas texture modified since the last upload, see ImFontAtlas::TexDirtyRects.
+struct ImFontAtlasDirtyRect
+{
+    unsigned short  X, Y;           // Top-left corner in pixels
+    unsigned short  Width, Height;  // Size in pixels
+};
+
+// Additional texture page of an atlas, when glyphs don't fit in ImFontAtlas::TexMaxHeight or are signed distance fields. Same size as the first page (TexWidth x TexHeight).
+struct ImFontAtlasTexPage
+{
+    ImTextureID     TexID;          // User data to refer to the texture of this page once uploaded (see ImFontAtlas::SetTexPageID())
+    unsigned char*  PixelsAlpha8;   // 1 component per pixel. Total size = TexWidth * TexHeight
+    unsigned int*   PixelsRGBA32;   // 4 components per pixel. Total size = TexWidth * TexHeight * 4
+    bool            SDF;            // Page holds signed distance field glyphs (ImFontConfig::SDF): alpha is 0.5 on glyph edges. Backend needs to draw it with a distance field shader.
+};
+
 // Flags for ImFontAtlas build
 enum ImFontAtlasFlags_
 {
@@ -2844,8 +2957,17 @@ enum ImFontAtlasFlags_
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
     ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
     ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_NoBakedRoundCorners= 1 << 3,   // Don't build filled circle/rounded corner textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedFillUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_DynamicGlyphs      = 1 << 4,   // Only rasterize glyphs in the 0x00-0xFF range during Build(), other glyphs in the font ranges are rasterized into free atlas space the first time they are used. Modified regions are reported in TexDirtyRects[]. Requires a backend with ImGuiBackendFlags_RendererHasTexUpdates. Not supported with ImFontConfig::SDF.
+    ImFontAtlasFlags_PackShelves        = 1 << 5,   // Pack glyphs and custom rectangles on shelves of similar heights instead of using stb_rectpack's skyline packer. Much faster for very large glyph sets (e.g. full CJK ranges), usually at the cost of a few percent more texture space. See Metrics/Debugger window for atlas occupancy.
+    ImFontAtlasFlags_ClearTexDataAfterUpload = 1 << 6, // Backends call ClearTexData() once the texture is uploaded, freeing CPU pixels memory. Recreating the texture (e.g. after device loss) will Build() again. Ignored with ImFontAtlasFlags_DynamicGlyphs. Supported by OpenGL3, Vulkan, SDL_Renderer2/3 backends.
+    ImFontAtlasFlags_MapFontFiles       = 1 << 7,   // AddFontFromFileTTF() memory-maps font files instead of reading them into heap memory. Files stay open and are only mapped during Build() (or while glyphs can be rasterized with ImFontAtlasFlags_DynamicGlyphs). Don't truncate or overwrite a font file in place while the atlas uses it. Ignored with IMGUI_DISABLE_FILE_MAPPING.
 };
 
+// Callback to run independent font atlas build jobs on your own job system, see ImFontAtlas::BuildParallelForFunc.
+// Must call job_func(job_data, n) once for every n in [0, job_count), in any order and from any thread, and only return when all calls are finished.
+typedef void (*ImFontAtlasParallelForFunc)(void (*job_func)(void* job_data, int job_index), void* job_data, int job_count, void* user_data);
+
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
 //  - One or more fonts.
 //  - Custom graphics data needed to render the shapes needed by Dear ImGui.
@@ -2869,7 +2991,7 @@ struct ImFontAtlas
     IMGUI_API ~ImFontAtlas();
     IMGUI_API ImFont*           AddFont(const ImFontConfig* font_cfg);
     IMGUI_API ImFont*           AddFontDefault(const ImFontConfig* font_cfg = NULL);
-    IMGUI_API ImFont*           AddFontFromFileTTF(const char* filename, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL);
+    IMGUI_API ImFont*           AddFontFromFileTTF(const char* filename, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL); // With ImFontAtlasFlags_MapFontFiles: file is memory-mapped when supported (no heap copy) and unmapped after Build().
     IMGUI_API ImFont*           AddFontFromMemoryTTF(void* font_data, int font_size, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL); // Note: Transfer ownership of 'ttf_data' to ImFontAtlas! Will be deleted after destruction of the atlas. Set font_cfg->FontDataOwnedByAtlas=false to keep ownership of your data and it won't be freed.
     IMGUI_API ImFont*           AddFontFromMemoryCompressedTTF(const void* compressed_font_data, int compressed_font_size, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL); // 'compressed_font_data' still owned by caller. Compress with binary_to_compressed_c.cpp.
     IMGUI_API ImFont*           AddFontFromMemoryCompressedBase85TTF(const char* compressed_font_data_base85, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL);              // 'compressed_font_data_base85' still owned by caller. Compress with binary_to_compressed_c.cpp with -base85 parameter.
@@ -2889,6 +3011,27 @@ struct ImFontAtlas
     bool                        IsBuilt() const             { return Fonts.Size > 0 && TexReady; } // Bit ambiguous: used to detect when user didn't build texture but effectively we should check TexID != 0 except that would be backend dependent...
     void                        SetTexID(ImTextureID id)    { TexID = id; }
 
+    // Texture pages: when TexMaxHeight is set and glyphs don't fit, or for ImFontConfig::SDF glyphs, Build() packs them into additional textures of the same size.
+    // Page 0 is the texture returned by GetTexDataAsXXX() and SetTexID(). Backends supporting pages (ImGuiBackendFlags_RendererHasTexPages) create a texture for each page.
+    int                         GetTexPageCount() const                     { return 1 + TexExtraPages.Size; }
+    IMGUI_API void              GetTexPageDataAsAlpha8(int page, unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel = NULL);
+    IMGUI_API void              GetTexPageDataAsRGBA32(int page, unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel = NULL);
+    IMGUI_API void              GetTexPageData(int page, unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel); // 1 byte per-pixel, or 4 bytes per-pixel when TexPixelsUseColors is set or RGBA32 data was already requested (e.g. to write colored custom rects). For backends sampling single channel textures.
+    ImTextureID                 GetTexPageID(int page) const                { IM_ASSERT(page >= 0 && page < GetTexPageCount()); return (page == 0) ? TexID : TexExtraPages.Data[page - 1].TexID; }
+    void                        SetTexPageID(int page, ImTextureID id)      { IM_ASSERT(page >= 0 && page < GetTexPageCount()); if (page == 0) TexID = id; else TexExtraPages.Data[page - 1].TexID = id; }
+    bool                        IsTexPageSDF(int page) const                { IM_ASSERT(page >= 0 && page < GetTexPageCount()); return page > 0 && TexExtraPages.Data[page - 1].SDF; }
+
+    // Cache of built atlas: store pixels, glyphs and custom rectangles positions to skip Build() on next run when inputs are identical.
+    // Add your fonts and custom rectangles, then call BuildWithCache() instead of Build(). Data is keyed by CalcCacheKey(), a hash of all build inputs (including TTF data).
+    // - Not supported with ImFontAtlasFlags_DynamicGlyphs. The key doesn't identify custom FontBuilderIO implementations: use different filenames for them.
+    // - TexPixelsAlpha8 is saved when available, so pixels of custom rectangles need to be written there (or call SaveCache*() yourself after writing them).
+    IMGUI_API bool              BuildWithCache(const char* filename);                       // Load from 'filename' if it matches current inputs, otherwise Build() and save to 'filename'.
+    IMGUI_API bool              LoadCacheFromDisk(const char* filename);
+    IMGUI_API bool              LoadCacheFromMemory(const void* data, size_t data_size);    // Return false if data doesn't match current inputs. Data is copied: you may pass a memory-mapped file and unmap it after returning.
+    IMGUI_API bool              SaveCacheToDisk(const char* filename);
+    IMGUI_API bool              SaveCacheToMemory(ImVector<unsigned char>* out_data);       // Atlas needs to be built.
+    IMGUI_API ImU32             CalcCacheKey();                                             // Return 0 if font data isn't available (a mapped font file changed), which never matches a cache.
+
     //-------------------------------------------
     // Glyph Ranges
     //-------------------------------------------
@@ -2933,9 +3076,13 @@ struct ImFontAtlas
     ImFontAtlasFlags            Flags;              // Build flags (see ImFontAtlasFlags_)
     ImTextureID                 TexID;              // User data to refer to the texture once it has been uploaded to user's graphic systems. It is passed back to you during rendering via the ImDrawCmd structure.
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
+    int                         TexMaxHeight;       // Maximum texture height before Build(). 0 = no limit. Glyphs which don't fit are packed into additional texture pages of TexWidth x TexMaxHeight (see GetTexPageCount()). Should be a power-of-two unless using ImFontAtlasFlags_NoPowerOfTwoHeight.
     int                         TexGlyphPadding;    // Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0 (will also need to set AntiAliasedLinesUseTex = false).
     bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert.
     void*                       UserData;           // Store your own atlas related user-data (if e.g. you have multiple font atlas).
+    ImVector<ImFontAtlasDirtyRect> TexDirtyRects;   // With ImFontAtlasFlags_DynamicGlyphs: regions of the texture modified since it was uploaded. Backend uploads them then clears the array.
+    ImFontAtlasParallelForFunc  BuildParallelForFunc;     // Optional: run Build() glyph lookup and rasterization jobs in parallel on your job system. Jobs allocate memory concurrently: allocators set with SetAllocatorFunctions() (and ImGuiFreeType::SetAllocatorFunctions()) need to be thread-safe. Output is identical to a serial build.
+    void*                       BuildParallelForUserData; // User data passed to BuildParallelForFunc.
 
     // [Internal]
     // NB: Access texture data via GetTexData*() calls! Which will setup a default font for you.
@@ -2949,16 +3096,22 @@ struct ImFontAtlas
     ImVec2                      TexUvWhitePixel;    // Texture coordinates to a white pixel
     ImVector<ImFont*>           Fonts;              // Hold all the fonts returned by AddFont*. Fonts[0] is the default font upon calling ImGui::NewFrame(), use ImGui::PushFont()/PopFont() to change the current font.
     ImVector<ImFontAtlasCustomRect> CustomRects;    // Rectangles for packing custom texture data into the atlas.
+    ImVector<ImFontAtlasTexPage> TexExtraPages;     // Texture pages after the first one (which uses TexID, TexPixelsAlpha8, TexPixelsRGBA32). Pixels are freed by ClearTexData(), TexID are kept.
     ImVector<ImFontConfig>      ConfigData;         // Configuration data
     ImVec4                      TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];  // UVs for baked anti-aliased lines
+    ImVec4                      TexUvRoundCorners[IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX * 2 + 1]; // UVs for baked anti-aliased quarter discs, indexed by radius*2. xy = center, zw = (radius+1) pixels away from center.
 
     // [Internal] Font builder
     const ImFontBuilderIO*      FontBuilderIO;      // Opaque interface to a font builder (default to stb_truetype, can be changed to use FreeType by defining IMGUI_ENABLE_FREETYPE).
     unsigned int                FontBuilderFlags;   // Shared flags (for all fonts) for custom font builder. THIS IS BUILD IMPLEMENTATION DEPENDENT. Per-font override is also available in ImFontConfig.
+    const ImFontBuilderIO*      FontBuilderIOUsed;  // Font builder which built the current texture (NULL if not built)
+    void*                       FontBuilderData;    // Font builder data kept alive after Build() to rasterize glyphs on demand (ImFontAtlasFlags_DynamicGlyphs)
+    void*                       DynamicPacker;      // Rectangle packer for the free space left after Build() (ImFontAtlasFlags_DynamicGlyphs)
 
     // [Internal] Packing data
     int                         PackIdMouseCursors; // Custom texture rectangle ID for white pixel and mouse cursors
     int                         PackIdLines;        // Custom texture rectangle ID for baked anti-aliased lines
+    int                         PackIdRoundCorners; // Custom texture rectangle ID for baked anti-aliased filled circles and rounded corners
 
     // [Obsolete]
     //typedef ImFontAtlasCustomRect    CustomRect;         // OBSOLETED in 1.72+
@@ -2969,16 +3122,21 @@ struct ImFontAtlas
 // ImFontAtlas automatically loads a default embedded font for you when you call GetTexDataAsAlpha8() or GetTexDataAsRGBA32().
 struct ImFont
 {
-    // Members: Hot ~20/24 bytes (for CalcTextSize)
-    ImVector<float>             IndexAdvanceX;      // 12-16 // out //            // Sparse. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this this info, and are often bottleneck in large UI).
+    // Members: Hot ~32/40 bytes (for CalcTextSize)
+    ImVector<ImU16>             IndexPageMap;       // 12-16 // out //            // Index in IndexPages[] for each block of 256 code-points, up to the highest one with a glyph. Blocks without glyph map to page 0.
+    ImVector<ImFontIndexPage>   IndexPages;         // 12-16 // out //            // Sparse. Glyphs->AdvanceX and index of glyphs by Unicode code-point. Page 0 is shared by all blocks without glyph.
     float                       FallbackAdvanceX;   // 4     // out // = FallbackGlyph->AdvanceX
     float                       FontSize;           // 4     // in  //            // Height of characters/line, set during loading (don't change after loading)
 
-    // Members: Hot ~28/40 bytes (for CalcTextSize + render loop)
-    ImVector<ImWchar>           IndexLookup;        // 12-16 // out //            // Sparse. Index glyphs by Unicode code-point.
+    // Members: Hot ~16/24 bytes (for CalcTextSize + render loop)
     ImVector<ImFontGlyph>       Glyphs;             // 12-16 // out //            // All glyphs.
     const ImFontGlyph*          FallbackGlyph;      // 4-8   // out // = FindGlyph(FontFallbackChar)
 
+    // Members: Hot 768/1024 bytes (for ASCII fast path in CalcTextSize + render loop)
+    float                       AsciiAdvanceX[128]; // 512   // out //            // Copy of GetIndexAdvanceX() for 0x20..0x7F: no bounds check needed.
+    ImWchar                     AsciiGlyphIndex[128];// 256-512 // out //         // Index in Glyphs[] of FindGlyph() result for 0x20..0x7F.
+    bool                        AsciiFastPath;      // 1     // out //            // Above tables are valid (false if any of 0x20..0x7F is not resolved yet, or resolves to no glyph).
+
     // Members: Cold ~32/40 bytes
     ImFontAtlas*                ContainerAtlas;     // 4-8   // out //            // What we has been loaded into
     const ImFontConfig*         ConfigData;         // 4-8   // in  //            // Pointer within ContainerAtlas->ConfigData
@@ -2993,13 +3151,17 @@ struct ImFont
     float                       Ascent, Descent;    // 4+4   // out //            // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize]
     int                         MetricsTotalSurface;// 4     // out //            // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
     ImU8                        Used4kPagesMap[(IM_UNICODE_CODEPOINT_MAX+1)/4096/8]; // 2 bytes if ImWchar=ImWchar16, 34 bytes if ImWchar==ImWchar32. Store 1-bit for each block of 4K codepoints that has one active glyph. This is mainly used to facilitate iterations across all used codepoints.
+    ImU32                       LookupTablesVersion;// 4     // out //            // Changed whenever IndexPages[] are rebuilt or remapped. Unique across fonts, used as a key by caches of text sizes (io.ConfigTextSizeCache).
+    bool                        DeferredGlyphs;     // 1     // out //            // Font built with ImFontConfig::Deferred and not used yet: no glyph is rasterized and every code-point resolves to IM_FONTGLYPH_INDEX_NOT_LOADED.
 
     // Methods
     IMGUI_API ImFont();
     IMGUI_API ~ImFont();
     IMGUI_API const ImFontGlyph*FindGlyph(ImWchar c) const;
     IMGUI_API const ImFontGlyph*FindGlyphNoFallback(ImWchar c) const;
-    float                       GetCharAdvance(ImWchar c) const     { return ((int)c < IndexAdvanceX.Size) ? IndexAdvanceX[(int)c] : FallbackAdvanceX; }
+    float                       GetCharAdvance(ImWchar c) const     { float w = GetIndexAdvanceX(c); if (w < 0.0f) { const_cast<ImFont*>(this)->LoadGlyph(c); w = GetIndexAdvanceX(c); } return w; } // Negative advance = glyph not rasterized yet (ImFontAtlasFlags_DynamicGlyphs)
+    float                       GetIndexAdvanceX(unsigned int c) const { unsigned int page_n = c / IM_FONT_INDEX_PAGE_SIZE; return (page_n < (unsigned int)IndexPageMap.Size) ? IndexPages.Data[IndexPageMap.Data[page_n]].AdvanceX[c % IM_FONT_INDEX_PAGE_SIZE] : FallbackAdvanceX; }
+    ImWchar                     GetIndexLookup(unsigned int c) const   { unsigned int page_n = c / IM_FONT_INDEX_PAGE_SIZE; return (page_n < (unsigned int)IndexPageMap.Size) ? IndexPages.Data[IndexPageMap.Data[page_n]].Lookup[c % IM_FONT_INDEX_PAGE_SIZE] : (ImWchar)-1; }
     bool                        IsLoaded() const                    { return ContainerAtlas != NULL; }
     const char*                 GetDebugName() const                { return ConfigData ? ConfigData->Name : "<unknown>"; }
 
@@ -3012,9 +3174,13 @@ struct ImFont
 
     // [Internal] Don't use!
     IMGUI_API void              BuildLookupTable();
+    IMGUI_API void              BuildAsciiLookupTable();
     IMGUI_API void              ClearOutputData();
-    IMGUI_API void              GrowIndex(int new_size);
+    IMGUI_API void              GrowIndex(int new_size);            // Extend IndexPageMap[] to cover code-points < new_size
+    IMGUI_API ImFontIndexPage*  GetOrAddIndexPage(unsigned int c);  // Page holding the lookup tables for 'c', allocated if needed. May reallocate IndexPages[].
     IMGUI_API void              AddGlyph(const ImFontConfig* src_cfg, ImWchar c, float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float advance_x);
+    IMGUI_API const ImFontGlyph*LoadGlyph(ImWchar c);                  // Rasterize a glyph on demand (ImFontAtlasFlags_DynamicGlyphs). Called by FindGlyph().
+    IMGUI_API void              LoadDeferredGlyphs();               // Rasterize the glyphs Build() skipped for a ImFontConfig::Deferred font. Called on first use by SetCurrentFont(), ImDrawList::AddText() and LoadGlyph().
     IMGUI_API void              AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst = true); // Makes 'dst' character/glyph points to 'src' character/glyph. Currently needs to be called AFTER fonts have been built.
     IMGUI_API void              SetGlyphVisible(ImWchar c, bool visible);
     IMGUI_API bool              IsGlyphRangeUnused(unsigned int c_begin, unsigned int c_last);
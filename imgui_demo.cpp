@@ -469,6 +469,14 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::SameLine(); HelpMarker("Enable resizing of windows from their edges and from the lower-left corner.\nThis requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback.");
             ImGui::Checkbox("io.ConfigWindowsMoveFromTitleBarOnly", &io.ConfigWindowsMoveFromTitleBarOnly);
             ImGui::Checkbox("io.ConfigMacOSXBehaviors", &io.ConfigMacOSXBehaviors);
+            ImGui::Checkbox("io.ConfigDrawDataDirtyRects", &io.ConfigDrawDataDirtyRects);
+            ImGui::SameLine(); HelpMarker("Compare draw lists with the previous frame and output changed screen rectangles in ImDrawData::DirtyRects, for backends supporting partial redraw.\nSee Metrics/Debugger window->Viewports for dirty rectangles.");
+            ImGui::Checkbox("io.ConfigDrawDataFingerprint", &io.ConfigDrawDataFingerprint);
+            ImGui::SameLine(); HelpMarker("Hash draw lists and set ImDrawData::Unchanged when identical to the previous frame, so the application can skip rendering and presenting.");
+            ImGui::Checkbox("io.ConfigDrawDataMergeLists", &io.ConfigDrawDataMergeLists);
+            ImGui::SameLine(); HelpMarker("Merge consecutive draw lists in Render(), joining compatible draw commands across windows to reduce draw calls.\nSee Metrics/Debugger window for draw command counts.");
+            ImGui::Checkbox("io.ConfigTextSizeCache", &io.ConfigTextSizeCache);
+            ImGui::SameLine(); HelpMarker("Cache results of CalcTextSize() across frames, so labels submitted every frame are measured once.\nSee Metrics/Debugger window for hit rate.");
             ImGui::Text("Also see Style->Rendering for rendering options.");
 
             ImGui::SeparatorText("Debug");
@@ -500,6 +508,9 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::CheckboxFlags("io.BackendFlags: HasMouseCursors",      &io.BackendFlags, ImGuiBackendFlags_HasMouseCursors);
             ImGui::CheckboxFlags("io.BackendFlags: HasSetMousePos",       &io.BackendFlags, ImGuiBackendFlags_HasSetMousePos);
             ImGui::CheckboxFlags("io.BackendFlags: RendererHasVtxOffset", &io.BackendFlags, ImGuiBackendFlags_RendererHasVtxOffset);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasShapes",    &io.BackendFlags, ImGuiBackendFlags_RendererHasShapes);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasTexPages",  &io.BackendFlags, ImGuiBackendFlags_RendererHasTexPages);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasSDF",       &io.BackendFlags, ImGuiBackendFlags_RendererHasSDF);
             ImGui::EndDisabled();
             ImGui::TreePop();
             ImGui::Spacing();
@@ -6183,11 +6194,18 @@ void ImGui::ShowAboutWindow(bool* p_open)
         if (io.ConfigWindowsResizeFromEdges)                            ImGui::Text("io.ConfigWindowsResizeFromEdges");
         if (io.ConfigWindowsMoveFromTitleBarOnly)                       ImGui::Text("io.ConfigWindowsMoveFromTitleBarOnly");
         if (io.ConfigMemoryCompactTimer >= 0.0f)                        ImGui::Text("io.ConfigMemoryCompactTimer = %.1f", io.ConfigMemoryCompactTimer);
+        if (io.ConfigDrawDataDirtyRects)                                ImGui::Text("io.ConfigDrawDataDirtyRects");
+        if (io.ConfigDrawDataFingerprint)                               ImGui::Text("io.ConfigDrawDataFingerprint");
+        if (io.ConfigDrawDataMergeLists)                                ImGui::Text("io.ConfigDrawDataMergeLists");
+        if (io.ConfigTextSizeCache)                                     ImGui::Text("io.ConfigTextSizeCache");
         ImGui::Text("io.BackendFlags: 0x%08X", io.BackendFlags);
         if (io.BackendFlags & ImGuiBackendFlags_HasGamepad)             ImGui::Text(" HasGamepad");
         if (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors)        ImGui::Text(" HasMouseCursors");
         if (io.BackendFlags & ImGuiBackendFlags_HasSetMousePos)         ImGui::Text(" HasSetMousePos");
         if (io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)   ImGui::Text(" RendererHasVtxOffset");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasShapes)      ImGui::Text(" RendererHasShapes");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasTexPages)    ImGui::Text(" RendererHasTexPages");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasSDF)         ImGui::Text(" RendererHasSDF");
         ImGui::Separator();
         ImGui::Text("io.Fonts: %d fonts, Flags: 0x%08X, TexSize: %d,%d", io.Fonts->Fonts.Size, io.Fonts->Flags, io.Fonts->TexWidth, io.Fonts->TexHeight);
         ImGui::Text("io.DisplaySize: %.2f,%.2f", io.DisplaySize.x, io.DisplaySize.y);
@@ -6476,6 +6494,10 @@ void ImGui::ShowStyleEditor(ImGuiStyle* ref)
             HelpMarker("Faster lines using texture data. Require backend to render with bilinear filtering (not point/nearest filtering).");
 
             ImGui::Checkbox("Anti-aliased fill", &style.AntiAliasedFill);
+            ImGui::Checkbox("Anti-aliased fill use texture", &style.AntiAliasedFillUseTex);
+            ImGui::SameLine();
+            HelpMarker("Faster filled circles and rounded rectangles using texture data. Require backend to render with bilinear filtering (not point/nearest filtering).");
+
             ImGui::PushItemWidth(ImGui::GetFontSize() * 8);
             ImGui::DragFloat("Curve Tessellation Tolerance", &style.CurveTessellationTol, 0.02f, 0.10f, 10.0f, "%.2f");
             if (style.CurveTessellationTol < 0.10f) style.CurveTessellationTol = 0.10f;
@@ -38,6 +38,10 @@ Index of this file:
 #endif
 
 #include <stdio.h>      // vsnprintf, sscanf, printf
+#ifdef IMGUI_ENABLE_FONT_BUILD_THREADS
+#include <atomic>       // std::atomic
+#include <thread>       // std::thread
+#endif
 
 // Visual Studio warnings
 #ifdef _MSC_VER
@@ -84,6 +88,23 @@ Index of this file:
 //#define IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION
 //#define IMGUI_DISABLE_STB_RECT_PACK_IMPLEMENTATION
 
+#ifdef IMGUI_ENABLE_STB_TRUETYPE
+// stb_truetype may rasterize glyphs from worker threads (see ImFontAtlasBuildParallelFor()).
+// Call allocators directly, as IM_ALLOC()/IM_FREE() also update io.MetricsActiveAllocations which is not thread-safe.
+static void* ImFontAtlasBuildStbttAlloc(size_t size)
+{
+    ImGuiMemAllocFunc alloc_func; ImGuiMemFreeFunc free_func; void* user_data;
+    ImGui::GetAllocatorFunctions(&alloc_func, &free_func, &user_data);
+    return alloc_func(size, user_data);
+}
+static void ImFontAtlasBuildStbttFree(void* ptr)
+{
+    ImGuiMemAllocFunc alloc_func; ImGuiMemFreeFunc free_func; void* user_data;
+    ImGui::GetAllocatorFunctions(&alloc_func, &free_func, &user_data);
+    free_func(ptr, user_data);
+}
+#endif
+
 #ifdef IMGUI_STB_NAMESPACE
 namespace IMGUI_STB_NAMESPACE
 {
@@ -128,8 +149,8 @@ namespace IMGUI_STB_NAMESPACE
 #ifdef  IMGUI_ENABLE_STB_TRUETYPE
 #ifndef STB_TRUETYPE_IMPLEMENTATION                         // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
 #ifndef IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION           // in case the user already have an implementation in another compilation unit
-#define STBTT_malloc(x,u)   ((void)(u), IM_ALLOC(x))
-#define STBTT_free(x,u)     ((void)(u), IM_FREE(x))
+#define STBTT_malloc(x,u)   ((void)(u), ImFontAtlasBuildStbttAlloc(x))
+#define STBTT_free(x,u)     ((void)(u), ImFontAtlasBuildStbttFree(x))
 #define STBTT_assert(x)     do { IM_ASSERT(x); } while(0)
 #define STBTT_fmod(x,y)     ImFmod(x,y)
 #define STBTT_sqrt(x)       ImSqrt(x)
@@ -137,6 +158,9 @@ namespace IMGUI_STB_NAMESPACE
 #define STBTT_fabs(x)       ImFabs(x)
 #define STBTT_ifloor(x)     ((int)ImFloorSigned(x))
 #define STBTT_iceil(x)      ((int)ImCeil(x))
+#if defined(IMGUI_ENABLE_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define STBTT_SSE2          // Vectorized rasterizer accumulation and oversampling prefilters
+#endif
 #define STBTT_STATIC
 #define STB_TRUETYPE_IMPLEMENTATION
 #else
@@ -382,6 +406,10 @@ void ImDrawListSharedData::SetCircleTessellationMaxError(float max_error)
     ArcFastRadiusCutoff = IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC_R(IM_DRAWLIST_ARCFAST_SAMPLE_MAX, CircleSegmentMaxError);
 }
 
+// Shared by all draw lists, so that a list allocated at the address of a destroyed one never gets the same _ResetStamp.
+// Concurrent resets may get the same value, but they are on lists alive at different addresses.
+static unsigned int GImDrawListResetStamp = 0;
+
 // Initialize before use in a new frame. We always have a command ready in the buffer.
 void ImDrawList::_ResetForNewFrame()
 {
@@ -395,6 +423,7 @@ void ImDrawList::_ResetForNewFrame()
     CmdBuffer.resize(0);
     IdxBuffer.resize(0);
     VtxBuffer.resize(0);
+    ShapeBuffer.resize(0);
     Flags = _Data->InitialFlags;
     memset(&_CmdHeader, 0, sizeof(_CmdHeader));
     _VtxCurrentIdx = 0;
@@ -406,6 +435,9 @@ void ImDrawList::_ResetForNewFrame()
     _Splitter.Clear();
     CmdBuffer.push_back(ImDrawCmd());
     _FringeScale = 1.0f;
+    _ResetStamp = ++GImDrawListResetStamp;
+    if (_ResetStamp == 0)
+        _ResetStamp = ++GImDrawListResetStamp;
 }
 
 void ImDrawList::_ClearFreeMemory()
@@ -413,6 +445,7 @@ void ImDrawList::_ClearFreeMemory()
     CmdBuffer.clear();
     IdxBuffer.clear();
     VtxBuffer.clear();
+    ShapeBuffer.clear();
     Flags = ImDrawListFlags_None;
     _VtxCurrentIdx = 0;
     _VtxWritePtr = NULL;
@@ -421,6 +454,7 @@ void ImDrawList::_ClearFreeMemory()
     _TextureIdStack.clear();
     _Path.clear();
     _Splitter.ClearFreeMemory();
+    _ResetStamp = 0;
 }
 
 ImDrawList* ImDrawList::CloneOutput() const
@@ -429,6 +463,7 @@ ImDrawList* ImDrawList::CloneOutput() const
     dst->CmdBuffer = CmdBuffer;
     dst->IdxBuffer = IdxBuffer;
     dst->VtxBuffer = VtxBuffer;
+    dst->ShapeBuffer = ShapeBuffer;
     dst->Flags = Flags;
     return dst;
 }
@@ -452,7 +487,7 @@ void ImDrawList::_PopUnusedDrawCmd()
     while (CmdBuffer.Size > 0)
     {
         ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
-        if (curr_cmd->ElemCount != 0 || curr_cmd->UserCallback != NULL)
+        if (curr_cmd->ElemCount != 0 || curr_cmd->UserCallback != NULL || curr_cmd->ShapeCount != 0)
             return;// break;
         CmdBuffer.pop_back();
     }
@@ -486,7 +521,7 @@ void ImDrawList::_TryMergeDrawCmds()
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     ImDrawCmd* prev_cmd = curr_cmd - 1;
-    if (ImDrawCmd_HeaderCompare(curr_cmd, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && curr_cmd->UserCallback == NULL && prev_cmd->UserCallback == NULL)
+    if (ImDrawCmd_HeaderCompare(curr_cmd, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && curr_cmd->UserCallback == NULL && prev_cmd->UserCallback == NULL && curr_cmd->ShapeCount == 0 && prev_cmd->ShapeCount == 0)
     {
         prev_cmd->ElemCount += curr_cmd->ElemCount;
         CmdBuffer.pop_back();
@@ -509,7 +544,7 @@ void ImDrawList::_OnChangedClipRect()
 
     // Try to merge with previous command if it matches, else use current command
     ImDrawCmd* prev_cmd = curr_cmd - 1;
-    if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
+    if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL && prev_cmd->ShapeCount == 0)
     {
         CmdBuffer.pop_back();
         return;
@@ -532,7 +567,7 @@ void ImDrawList::_OnChangedTextureID()
 
     // Try to merge with previous command if it matches, else use current command
     ImDrawCmd* prev_cmd = curr_cmd - 1;
-    if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
+    if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL && prev_cmd->ShapeCount == 0)
     {
         CmdBuffer.pop_back();
         return;
@@ -557,6 +592,35 @@ void ImDrawList::_OnChangedVtxOffset()
     curr_cmd->VtxOffset = _CmdHeader.VtxOffset;
 }
 
+// Append a shape instance (see ImDrawListFlags_ShapeInstances). Shapes are rendered after the triangles of the command carrying them,
+// so we always open a new command after a shape command, and append consecutive shapes to it as long as nothing was drawn in-between.
+void ImDrawList::_AddShape(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, float rounding, float thickness)
+{
+    IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
+    IM_ASSERT(Flags & ImDrawListFlags_AllowShapes);
+    ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    ImDrawCmd* prev_cmd = curr_cmd - 1;
+    IM_ASSERT(curr_cmd->UserCallback == NULL && curr_cmd->ShapeCount == 0);
+    if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && prev_cmd->ShapeCount != 0 && prev_cmd->ShapeOffset + prev_cmd->ShapeCount == (unsigned int)ShapeBuffer.Size && ImDrawCmd_HeaderCompare(curr_cmd, prev_cmd) == 0)
+    {
+        prev_cmd->ShapeCount++;
+    }
+    else
+    {
+        curr_cmd->ShapeOffset = (unsigned int)ShapeBuffer.Size;
+        curr_cmd->ShapeCount = 1;
+        AddDrawCmd(); // Force a new command after us
+    }
+
+    ShapeBuffer.resize(ShapeBuffer.Size + 1);
+    ImDrawShape& shape = ShapeBuffer.back();
+    shape.Min = p_min;
+    shape.Max = p_max;
+    shape.Rounding = rounding;
+    shape.Thickness = thickness;
+    shape.Col = col;
+}
+
 int ImDrawList::_CalcCircleAutoSegmentCount(float radius) const
 {
     // Automatic segment count
@@ -704,9 +768,136 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
 
+// Calculate normals (tangents) for each line segment of a polyline. Segment n goes from point n to point n+1, wrapping for closed lines.
+// The SSE path processes 4 segments at a time and outputs identical values to the scalar path (_mm_rsqrt_ps() matches _mm_rsqrt_ss() used by ImRsqrt()).
+static void PolylineCalcSegmentNormals(const ImVec2* points, const int points_count, const int count, ImVec2* out_normals)
+{
+    int i1 = 0;
+#ifdef IMGUI_ENABLE_SSE
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 sign_mask = _mm_set1_ps(-0.0f);
+    for (; i1 + 4 < points_count; i1 += 4)
+    {
+        const __m128 d01 = _mm_sub_ps(_mm_loadu_ps(&points[i1 + 1].x), _mm_loadu_ps(&points[i1 + 0].x)); // dx0 dy0 dx1 dy1
+        const __m128 d23 = _mm_sub_ps(_mm_loadu_ps(&points[i1 + 3].x), _mm_loadu_ps(&points[i1 + 2].x)); // dx2 dy2 dx3 dy3
+        __m128 dx = _mm_shuffle_ps(d01, d23, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 dy = _mm_shuffle_ps(d01, d23, _MM_SHUFFLE(3, 1, 3, 1));
+
+        // Inlined IM_NORMALIZE2F_OVER_ZERO()
+        const __m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        const __m128 d2_over_zero = _mm_cmpgt_ps(d2, zero);
+        const __m128 inv_len = _mm_rsqrt_ps(d2);
+        dx = _mm_or_ps(_mm_and_ps(d2_over_zero, _mm_mul_ps(dx, inv_len)), _mm_andnot_ps(d2_over_zero, dx));
+        dy = _mm_or_ps(_mm_and_ps(d2_over_zero, _mm_mul_ps(dy, inv_len)), _mm_andnot_ps(d2_over_zero, dy));
+
+        // Store (dy, -dx)
+        const __m128 neg_dx = _mm_xor_ps(dx, sign_mask);
+        _mm_storeu_ps(&out_normals[i1 + 0].x, _mm_unpacklo_ps(dy, neg_dx));
+        _mm_storeu_ps(&out_normals[i1 + 2].x, _mm_unpackhi_ps(dy, neg_dx));
+    }
+#endif
+    for (; i1 < count; i1++)
+    {
+        const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+        float dx = points[i2].x - points[i1].x;
+        float dy = points[i2].y - points[i1].y;
+        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+        out_normals[i1].x = dy;
+        out_normals[i1].y = -dx;
+    }
+}
+
+// Calculate averaged normals at each point of a polyline, used to offset the edges of the line at the joint between two segments.
+// The first point of an open line has no previous segment and keeps the normal of its segment as-is.
+static void PolylineCalcJointNormals(const ImVec2* normals, const int points_count, const bool closed, ImVec2* out_joints)
+{
+    int i2 = 1;
+#ifdef IMGUI_ENABLE_SSE
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 min_d2 = _mm_set1_ps(0.000001f);
+    const __m128 max_inv_len2 = _mm_set1_ps(IM_FIXNORMAL2F_MAX_INVLEN2);
+    for (; i2 + 4 <= points_count; i2 += 4)
+    {
+        const __m128 n01 = _mm_add_ps(_mm_loadu_ps(&normals[i2 - 1].x), _mm_loadu_ps(&normals[i2 + 0].x));
+        const __m128 n23 = _mm_add_ps(_mm_loadu_ps(&normals[i2 + 1].x), _mm_loadu_ps(&normals[i2 + 2].x));
+        __m128 dm_x = _mm_mul_ps(_mm_shuffle_ps(n01, n23, _MM_SHUFFLE(2, 0, 2, 0)), half);
+        __m128 dm_y = _mm_mul_ps(_mm_shuffle_ps(n01, n23, _MM_SHUFFLE(3, 1, 3, 1)), half);
+
+        // Inlined IM_FIXNORMAL2F()
+        const __m128 d2 = _mm_add_ps(_mm_mul_ps(dm_x, dm_x), _mm_mul_ps(dm_y, dm_y));
+        const __m128 d2_over_min = _mm_cmpgt_ps(d2, min_d2);
+        const __m128 inv_len2 = _mm_min_ps(_mm_div_ps(one, d2), max_inv_len2);
+        dm_x = _mm_or_ps(_mm_and_ps(d2_over_min, _mm_mul_ps(dm_x, inv_len2)), _mm_andnot_ps(d2_over_min, dm_x));
+        dm_y = _mm_or_ps(_mm_and_ps(d2_over_min, _mm_mul_ps(dm_y, inv_len2)), _mm_andnot_ps(d2_over_min, dm_y));
+
+        _mm_storeu_ps(&out_joints[i2 + 0].x, _mm_unpacklo_ps(dm_x, dm_y));
+        _mm_storeu_ps(&out_joints[i2 + 2].x, _mm_unpackhi_ps(dm_x, dm_y));
+    }
+#endif
+    for (; i2 < points_count; i2++)
+    {
+        float dm_x = (normals[i2 - 1].x + normals[i2].x) * 0.5f;
+        float dm_y = (normals[i2 - 1].y + normals[i2].y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        out_joints[i2].x = dm_x;
+        out_joints[i2].y = dm_y;
+    }
+    if (closed)
+    {
+        float dm_x = (normals[points_count - 1].x + normals[0].x) * 0.5f;
+        float dm_y = (normals[points_count - 1].y + normals[0].y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        out_joints[0].x = dm_x;
+        out_joints[0].y = dm_y;
+    }
+    else
+    {
+        out_joints[0] = normals[0];
+    }
+}
+
+// Coarse clipping: return true if a bounding box, expanded by 'pad' (e.g. for thickness) + anti-aliasing fringe, is entirely outside the current clip rectangle.
+// Clip rectangles are render-level scissoring so this is only an optimization: skipped primitives wouldn't have been visible. Disable with ImDrawListFlags_NoCoarseClip.
+static inline bool IsCoarseClipped(const ImDrawList* draw_list, const ImVec2& bb_min, const ImVec2& bb_max, float pad)
+{
+    if (draw_list->Flags & ImDrawListFlags_NoCoarseClip)
+        return false;
+    const ImVec4& clip_rect = draw_list->_CmdHeader.ClipRect;
+    pad += draw_list->_FringeScale;
+    return bb_min.x - pad >= clip_rect.z || bb_min.y - pad >= clip_rect.w || bb_max.x + pad <= clip_rect.x || bb_max.y + pad <= clip_rect.y;
+}
+
+static bool IsCoarseClipped(const ImDrawList* draw_list, const ImVec2* points, const int points_count, float pad)
+{
+    if (draw_list->Flags & ImDrawListFlags_NoCoarseClip)
+        return false;
+    ImVec2 bb_min = points[0], bb_max = points[0];
+    for (int i = 1; i < points_count; i++)
+    {
+        const ImVec2& p = points[i];
+        bb_min.x = ImMin(bb_min.x, p.x); bb_min.y = ImMin(bb_min.y, p.y);
+        bb_max.x = ImMax(bb_max.x, p.x); bb_max.y = ImMax(bb_max.y, p.y);
+    }
+    return IsCoarseClipped(draw_list, bb_min, bb_max, pad);
+}
+
+// Padding for coarse clipping of stroked paths: joints are mitered, up to sqrt(IM_FIXNORMAL2F_MAX_INVLEN2) times half the thickness (+ fringe).
+#define IM_COARSE_CLIP_MITER_PAD(_THICKNESS, _FRINGE)   (((_THICKNESS) * 0.5f + (_FRINGE)) * 10.0f)
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
+{
+    if (points_count < 2 || (col & IM_COL32_A_MASK) == 0)
+        return;
+    if (IsCoarseClipped(this, points, points_count, IM_COARSE_CLIP_MITER_PAD(thickness, _FringeScale)))
+        return;
+    _AddPolyline(points, points_count, col, flags, thickness);
+}
+
+// Same as AddPolyline() without coarse clipping, for shapes which were already coarse clipped as a whole by the caller.
+void ImDrawList::_AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
 {
     if (points_count < 2 || (col & IM_COL32_A_MASK) == 0)
         return;
@@ -740,25 +931,20 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         PrimReserve(idx_count, vtx_count);
 
         // Temporary buffer
-        // The first <points_count> items are normals at each line point, then after that there are either 2 or 4 temp points for each line point
-        _Data->TempBuffer.reserve_discard(points_count * ((use_texture || !thick_line) ? 3 : 5));
+        // The first <points_count> items are normals for each line segment, then after that are the averaged normals at each line point
+        _Data->TempBuffer.reserve_discard(points_count * 2);
         ImVec2* temp_normals = _Data->TempBuffer.Data;
-        ImVec2* temp_points = temp_normals + points_count;
+        ImVec2* temp_joints = temp_normals + points_count;
 
-        // Calculate normals (tangents) for each line segment
-        for (int i1 = 0; i1 < count; i1++)
-        {
-            const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
-            float dx = points[i2].x - points[i1].x;
-            float dy = points[i2].y - points[i1].y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i1].x = dy;
-            temp_normals[i1].y = -dx;
-        }
+        // Calculate normals (tangents) for each line segment, then averaged normals for each line point
+        PolylineCalcSegmentNormals(points, points_count, count, temp_normals);
         if (!closed)
             temp_normals[points_count - 1] = temp_normals[points_count - 2];
+        PolylineCalcJointNormals(temp_normals, points_count, closed, temp_joints);
 
-        // If we are drawing a one-pixel-wide line without a texture, or a textured line of any width, we only need 2 or 3 vertices per point
+        // Generate the vertices for the line edges and the indices to form a number of triangles for each line segment.
+        // Segment n uses vertices of point n and n+1, with the last segment in a closed line wrapping to the vertices of the first point.
+        unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
         if (use_texture || !thick_line)
         {
             // [PATH 1] Texture-based lines (thick or non-thick)
@@ -771,59 +957,6 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             //   allow scaling geometry while preserving one-screen-pixel AA fringe).
             const float half_draw_size = use_texture ? ((thickness * 0.5f) + 1) : AA_SIZE;
 
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
-            if (!closed)
-            {
-                temp_points[0] = points[0] + temp_normals[0] * half_draw_size;
-                temp_points[1] = points[0] - temp_normals[0] * half_draw_size;
-                temp_points[(points_count-1)*2+0] = points[points_count-1] + temp_normals[points_count-1] * half_draw_size;
-                temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * half_draw_size;
-            }
-
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
-            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
-            {
-                const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1; // i2 is the second point of the line segment
-                const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
-
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                dm_x *= half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
-                dm_y *= half_draw_size;
-
-                // Add temporary vertexes for the outer edges
-                ImVec2* out_vtx = &temp_points[i2 * 2];
-                out_vtx[0].x = points[i2].x + dm_x;
-                out_vtx[0].y = points[i2].y + dm_y;
-                out_vtx[1].x = points[i2].x - dm_x;
-                out_vtx[1].y = points[i2].y - dm_y;
-
-                if (use_texture)
-                {
-                    // Add indices for two triangles
-                    _IdxWritePtr[0] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[1] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[2] = (ImDrawIdx)(idx1 + 1); // Right tri
-                    _IdxWritePtr[3] = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[4] = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[5] = (ImDrawIdx)(idx2 + 0); // Left tri
-                    _IdxWritePtr += 6;
-                }
-                else
-                {
-                    // Add indexes for four triangles
-                    _IdxWritePtr[0] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[1] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[2] = (ImDrawIdx)(idx1 + 2); // Right tri 1
-                    _IdxWritePtr[3] = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4] = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5] = (ImDrawIdx)(idx2 + 0); // Right tri 2
-                    _IdxWritePtr[6] = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[7] = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[8] = (ImDrawIdx)(idx1 + 0); // Left tri 1
-                    _IdxWritePtr[9] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[10] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[11] = (ImDrawIdx)(idx2 + 1); // Left tri 2
-                    _IdxWritePtr += 12;
-                }
-
-                idx1 = idx2;
-            }
-
-            // Add vertexes for each point on the line
             if (use_texture)
             {
                 // If we're using textures we only need to emit the left/right edge vertices
@@ -838,22 +971,48 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 }*/
                 ImVec2 tex_uv0(tex_uvs.x, tex_uvs.y);
                 ImVec2 tex_uv1(tex_uvs.z, tex_uvs.w);
-                for (int i = 0; i < points_count; i++)
+                for (int i1 = 0; i1 < points_count; i1++)
                 {
-                    _VtxWritePtr[0].pos = temp_points[i * 2 + 0]; _VtxWritePtr[0].uv = tex_uv0; _VtxWritePtr[0].col = col; // Left-side outer edge
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 1]; _VtxWritePtr[1].uv = tex_uv1; _VtxWritePtr[1].col = col; // Right-side outer edge
+                    const float dm_x = temp_joints[i1].x * half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
+                    const float dm_y = temp_joints[i1].y * half_draw_size;
+                    _VtxWritePtr[0].pos.x = points[i1].x + dm_x; _VtxWritePtr[0].pos.y = points[i1].y + dm_y; _VtxWritePtr[0].uv = tex_uv0; _VtxWritePtr[0].col = col; // Left-side outer edge
+                    _VtxWritePtr[1].pos.x = points[i1].x - dm_x; _VtxWritePtr[1].pos.y = points[i1].y - dm_y; _VtxWritePtr[1].uv = tex_uv1; _VtxWritePtr[1].col = col; // Right-side outer edge
                     _VtxWritePtr += 2;
+
+                    if (i1 == count) // Last point of an open line doesn't start a segment
+                        break;
+                    const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + 2); // Vertex index for end of segment
+
+                    // Add indices for two triangles
+                    _IdxWritePtr[0] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[1] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[2] = (ImDrawIdx)(idx1 + 1); // Right tri
+                    _IdxWritePtr[3] = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[4] = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[5] = (ImDrawIdx)(idx2 + 0); // Left tri
+                    _IdxWritePtr += 6;
+                    idx1 = idx2;
                 }
             }
             else
             {
                 // If we're not using a texture, we need the center vertex as well
-                for (int i = 0; i < points_count; i++)
+                for (int i1 = 0; i1 < points_count; i1++)
                 {
-                    _VtxWritePtr[0].pos = points[i];              _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;       // Center of line
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 0]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col_trans; // Left-side outer edge
-                    _VtxWritePtr[2].pos = temp_points[i * 2 + 1]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col_trans; // Right-side outer edge
+                    const float dm_x = temp_joints[i1].x * half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
+                    const float dm_y = temp_joints[i1].y * half_draw_size;
+                    _VtxWritePtr[0].pos = points[i1];                                                     _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;       // Center of line
+                    _VtxWritePtr[1].pos.x = points[i1].x + dm_x; _VtxWritePtr[1].pos.y = points[i1].y + dm_y; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col_trans; // Left-side outer edge
+                    _VtxWritePtr[2].pos.x = points[i1].x - dm_x; _VtxWritePtr[2].pos.y = points[i1].y - dm_y; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col_trans; // Right-side outer edge
                     _VtxWritePtr += 3;
+
+                    if (i1 == count) // Last point of an open line doesn't start a segment
+                        break;
+                    const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + 3); // Vertex index for end of segment
+
+                    // Add indexes for four triangles
+                    _IdxWritePtr[0] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[1] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[2] = (ImDrawIdx)(idx1 + 2); // Right tri 1
+                    _IdxWritePtr[3] = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4] = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5] = (ImDrawIdx)(idx2 + 0); // Right tri 2
+                    _IdxWritePtr[6] = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[7] = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[8] = (ImDrawIdx)(idx1 + 0); // Left tri 1
+                    _IdxWritePtr[9] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[10] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[11] = (ImDrawIdx)(idx2 + 1); // Left tri 2
+                    _IdxWritePtr += 12;
+                    idx1 = idx2;
                 }
             }
         }
@@ -861,50 +1020,24 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         {
             // [PATH 2] Non texture-based lines (thick): we need to draw the solid line core and thus require four vertices per point
             const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
+            const float half_outer_thickness = half_inner_thickness + AA_SIZE;
 
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
-            if (!closed)
+            for (int i1 = 0; i1 < points_count; i1++)
             {
-                const int points_last = points_count - 1;
-                temp_points[0] = points[0] + temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[1] = points[0] + temp_normals[0] * (half_inner_thickness);
-                temp_points[2] = points[0] - temp_normals[0] * (half_inner_thickness);
-                temp_points[3] = points[0] - temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 0] = points[points_last] + temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 1] = points[points_last] + temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 2] = points[points_last] - temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 3] = points[points_last] - temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
-            }
+                const float dm_out_x = temp_joints[i1].x * half_outer_thickness;
+                const float dm_out_y = temp_joints[i1].y * half_outer_thickness;
+                const float dm_in_x = temp_joints[i1].x * half_inner_thickness;
+                const float dm_in_y = temp_joints[i1].y * half_inner_thickness;
+                _VtxWritePtr[0].pos.x = points[i1].x + dm_out_x; _VtxWritePtr[0].pos.y = points[i1].y + dm_out_y; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col_trans;
+                _VtxWritePtr[1].pos.x = points[i1].x + dm_in_x;  _VtxWritePtr[1].pos.y = points[i1].y + dm_in_y;  _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
+                _VtxWritePtr[2].pos.x = points[i1].x - dm_in_x;  _VtxWritePtr[2].pos.y = points[i1].y - dm_in_y;  _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
+                _VtxWritePtr[3].pos.x = points[i1].x - dm_out_x; _VtxWritePtr[3].pos.y = points[i1].y - dm_out_y; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
+                _VtxWritePtr += 4;
 
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
-            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
-            {
-                const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1); // i2 is the second point of the line segment
+                if (i1 == count) // Last point of an open line doesn't start a segment
+                    break;
                 const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
 
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE);
-                float dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
-                float dm_in_x = dm_x * half_inner_thickness;
-                float dm_in_y = dm_y * half_inner_thickness;
-
-                // Add temporary vertices
-                ImVec2* out_vtx = &temp_points[i2 * 4];
-                out_vtx[0].x = points[i2].x + dm_out_x;
-                out_vtx[0].y = points[i2].y + dm_out_y;
-                out_vtx[1].x = points[i2].x + dm_in_x;
-                out_vtx[1].y = points[i2].y + dm_in_y;
-                out_vtx[2].x = points[i2].x - dm_in_x;
-                out_vtx[2].y = points[i2].y - dm_in_y;
-                out_vtx[3].x = points[i2].x - dm_out_x;
-                out_vtx[3].y = points[i2].y - dm_out_y;
-
                 // Add indexes
                 _IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
                 _IdxWritePtr[3]  = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4]  = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5]  = (ImDrawIdx)(idx2 + 1);
@@ -913,19 +1046,44 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 _IdxWritePtr[12] = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[13] = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[14] = (ImDrawIdx)(idx1 + 3);
                 _IdxWritePtr[15] = (ImDrawIdx)(idx1 + 3); _IdxWritePtr[16] = (ImDrawIdx)(idx2 + 3); _IdxWritePtr[17] = (ImDrawIdx)(idx2 + 2);
                 _IdxWritePtr += 18;
-
                 idx1 = idx2;
             }
+        }
+        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
+    }
+    else if (Flags & ImDrawListFlags_JoinedLines)
+    {
+        // [PATH 5] Non texture-based, Non anti-aliased lines, sharing edge vertices between consecutive segments
+        const int idx_count = count * 6;
+        const int vtx_count = points_count * 2;
+        PrimReserve(idx_count, vtx_count);
 
-            // Add vertices
-            for (int i = 0; i < points_count; i++)
-            {
-                _VtxWritePtr[0].pos = temp_points[i * 4 + 0]; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col_trans;
-                _VtxWritePtr[1].pos = temp_points[i * 4 + 1]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-                _VtxWritePtr[2].pos = temp_points[i * 4 + 2]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-                _VtxWritePtr[3].pos = temp_points[i * 4 + 3]; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
-                _VtxWritePtr += 4;
-            }
+        // Temporary buffer: same layout and miter handling as the anti-aliased paths
+        _Data->TempBuffer.reserve_discard(points_count * 2);
+        ImVec2* temp_normals = _Data->TempBuffer.Data;
+        ImVec2* temp_joints = temp_normals + points_count;
+        PolylineCalcSegmentNormals(points, points_count, count, temp_normals);
+        if (!closed)
+            temp_normals[points_count - 1] = temp_normals[points_count - 2];
+        PolylineCalcJointNormals(temp_normals, points_count, closed, temp_joints);
+
+        const float half_thickness = thickness * 0.5f;
+        unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
+        for (int i1 = 0; i1 < points_count; i1++)
+        {
+            const float dm_x = temp_joints[i1].x * half_thickness;
+            const float dm_y = temp_joints[i1].y * half_thickness;
+            _VtxWritePtr[0].pos.x = points[i1].x + dm_x; _VtxWritePtr[0].pos.y = points[i1].y + dm_y; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;
+            _VtxWritePtr[1].pos.x = points[i1].x - dm_x; _VtxWritePtr[1].pos.y = points[i1].y - dm_y; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
+            _VtxWritePtr += 2;
+
+            if (i1 == count) // Last point of an open line doesn't start a segment
+                break;
+            const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + 2); // Vertex index for end of segment
+            _IdxWritePtr[0] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[1] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[2] = (ImDrawIdx)(idx2 + 1);
+            _IdxWritePtr[3] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[4] = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[5] = (ImDrawIdx)(idx1 + 1);
+            _IdxWritePtr += 6;
+            idx1 = idx2;
         }
         _VtxCurrentIdx += (ImDrawIdx)vtx_count;
     }
@@ -933,7 +1091,7 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
     {
         // [PATH 4] Non texture-based, Non anti-aliased lines
         const int idx_count = count * 6;
-        const int vtx_count = count * 4;    // FIXME-OPT: Not sharing edges
+        const int vtx_count = count * 4;    // Not sharing edges, see ImDrawListFlags_JoinedLines
         PrimReserve(idx_count, vtx_count);
 
         for (int i1 = 0; i1 < count; i1++)
@@ -965,6 +1123,16 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
 // - We intentionally avoid using ImVec2 and its math operators here to reduce cost to a minimum for debug/non-inlined builds.
 // - Filled shapes must always use clockwise winding order. The anti-aliasing fringe depends on it. Counter-clockwise shapes will have "inward" anti-aliasing.
 void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_count, ImU32 col)
+{
+    if (points_count < 3 || (col & IM_COL32_A_MASK) == 0)
+        return;
+    if (IsCoarseClipped(this, points, points_count, 0.0f))
+        return;
+    _AddConvexPolyFilled(points, points_count, col);
+}
+
+// Same as AddConvexPolyFilled() without coarse clipping, for shapes which were already coarse clipped as a whole by the caller.
+void ImDrawList::_AddConvexPolyFilled(const ImVec2* points, const int points_count, ImU32 col)
 {
     if (points_count < 3 || (col & IM_COL32_A_MASK) == 0)
         return;
@@ -1377,9 +1545,25 @@ void ImDrawList::AddLine(const ImVec2& p1, const ImVec2& p2, ImU32 col, float th
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (IsCoarseClipped(this, ImMin(p1, p2), ImMax(p1, p2) + ImVec2(1.0f, 1.0f), thickness * 0.5f))
+        return;
     PathLineTo(p1 + ImVec2(0.5f, 0.5f));
     PathLineTo(p2 + ImVec2(0.5f, 0.5f));
-    PathStroke(col, 0, thickness);
+    _PathStroke(col, 0, thickness);
+}
+
+// Shape instances only support all or none of the corners being rounded
+static inline bool IsShapeRounding(ImDrawFlags flags, float rounding)
+{
+    return rounding < 0.5f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone || (FixRectCornerFlags(flags) & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersAll;
+}
+
+// Same rounding clamping as PathRect() with all corners rounded
+static inline float CalcShapeRounding(const ImVec2& a, const ImVec2& b, ImDrawFlags flags, float rounding)
+{
+    if (rounding < 0.5f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
+        return 0.0f;
+    return ImMax(ImMin(rounding, ImMin(ImFabs(b.x - a.x), ImFabs(b.y - a.y)) * 0.5f - 1.0f), 0.0f);
 }
 
 // p_min = upper-left, p_max = lower-right
@@ -1388,27 +1572,132 @@ void ImDrawList::AddRect(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, fl
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (IsCoarseClipped(this, p_min, p_max, thickness))
+        return;
+    if ((Flags & (ImDrawListFlags_ShapeInstances | ImDrawListFlags_AllowShapes)) == (ImDrawListFlags_ShapeInstances | ImDrawListFlags_AllowShapes) && IsShapeRounding(flags, rounding))
+    {
+        // Same stroke rectangle and rounding clamping as below
+        const ImVec2 a = p_min + ImVec2(0.50f, 0.50f), b = p_max - ImVec2(0.50f, 0.50f);
+        _AddShape(a, b, col, CalcShapeRounding(a, b, flags, rounding), thickness);
+        return;
+    }
     if (Flags & ImDrawListFlags_AntiAliasedLines)
         PathRect(p_min + ImVec2(0.50f, 0.50f), p_max - ImVec2(0.50f, 0.50f), rounding, flags);
     else
         PathRect(p_min + ImVec2(0.50f, 0.50f), p_max - ImVec2(0.49f, 0.49f), rounding, flags); // Better looking lower-right corner and rounded non-AA shapes.
-    PathStroke(col, ImDrawFlags_Closed, thickness);
+    _PathStroke(col, ImDrawFlags_Closed, thickness);
+}
+
+// Return UVs of the baked anti-aliased quarter disc for a given radius (see ImFontAtlasBuildRenderRoundCornersTexData()), or NULL if we cannot use it.
+// - For now, only radii multiple of 0.5f are baked, other radii will be rendered using polygons.
+// - If AA_SIZE is not 1.0f we cannot use the texture path.
+static inline const ImVec4* GetTexUvRoundCorners(const ImDrawList* draw_list, float radius)
+{
+    if ((draw_list->Flags & (ImDrawListFlags_AntiAliasedFill | ImDrawListFlags_AntiAliasedFillUseTex)) != (ImDrawListFlags_AntiAliasedFill | ImDrawListFlags_AntiAliasedFillUseTex) || draw_list->_FringeScale != 1.0f)
+        return NULL;
+    const float radius_x2 = radius * 2.0f;
+    const int n = (int)radius_x2;
+    if (n < 1 || n > IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX * 2 || (radius_x2 - (float)n) > 0.00001f)
+        return NULL;
+
+    // We should never hit this, because NewFrame() doesn't set ImDrawListFlags_AntiAliasedFillUseTex unless ImFontAtlasFlags_NoBakedRoundCorners is off
+    IM_ASSERT_PARANOID(!(draw_list->_Data->Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedRoundCorners));
+    return &draw_list->_Data->TexUvRoundCorners[n];
 }
 
 void ImDrawList::AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, float rounding, ImDrawFlags flags)
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (IsCoarseClipped(this, p_min, p_max, 0.0f))
+        return;
+    if ((Flags & (ImDrawListFlags_ShapeInstances | ImDrawListFlags_AllowShapes)) == (ImDrawListFlags_ShapeInstances | ImDrawListFlags_AllowShapes) && IsShapeRounding(flags, rounding))
+    {
+        _AddShape(p_min, p_max, col, CalcShapeRounding(p_min, p_max, flags, rounding), 0.0f);
+        return;
+    }
     if (rounding < 0.5f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
     {
         PrimReserve(6, 4);
         PrimRect(p_min, p_max, col);
+        return;
     }
-    else
+
+    // Use baked quarter discs when possible: 16 vertices (+1 per non-rounded corner) in a 4x4 grid, regardless of rounding.
+    // Same rounding clamping as PathRect(). We need (rounding >= 1.5f) for the center of the quarter disc to be fully opaque.
+    const ImDrawFlags corner_flags = FixRectCornerFlags(flags);
+    float r = rounding;
+    r = ImMin(r, ImFabs(p_max.x - p_min.x) * ( ((corner_flags & ImDrawFlags_RoundCornersTop)  == ImDrawFlags_RoundCornersTop)  || ((corner_flags & ImDrawFlags_RoundCornersBottom) == ImDrawFlags_RoundCornersBottom) ? 0.5f : 1.0f ) - 1.0f);
+    r = ImMin(r, ImFabs(p_max.y - p_min.y) * ( ((corner_flags & ImDrawFlags_RoundCornersLeft) == ImDrawFlags_RoundCornersLeft) || ((corner_flags & ImDrawFlags_RoundCornersRight)  == ImDrawFlags_RoundCornersRight)  ? 0.5f : 1.0f ) - 1.0f);
+    const ImVec4* tex_uvs = (r >= 1.5f && p_max.x - p_min.x >= r * 2.0f && p_max.y - p_min.y >= r * 2.0f) ? GetTexUvRoundCorners(this, r) : NULL;
+    if (tex_uvs == NULL)
     {
         PathRect(p_min, p_max, rounding, flags);
-        PathFillConvex(col);
+        _PathFillConvex(col);
+        return;
+    }
+
+    // Grid columns/rows are: outer edge of AA fringe, center of left/top corners, center of right/bottom corners, outer edge of AA fringe.
+    // Corner cells map to the quarter disc (mirrored by UV), other cells sample coverage along the axes or at the center of the disc.
+    const float grid_x[4] = { p_min.x - 1.0f, p_min.x + r, p_max.x - r, p_max.x + 1.0f };
+    const float grid_y[4] = { p_min.y - 1.0f, p_min.y + r, p_max.y - r, p_max.y + 1.0f };
+    const float grid_u[4] = { tex_uvs->z, tex_uvs->x, tex_uvs->x, tex_uvs->z };
+    const float grid_v[4] = { tex_uvs->w, tex_uvs->y, tex_uvs->y, tex_uvs->w };
+    const ImDrawFlags corners_rounded[4] = { corner_flags & ImDrawFlags_RoundCornersTopLeft, corner_flags & ImDrawFlags_RoundCornersTopRight, corner_flags & ImDrawFlags_RoundCornersBottomRight, corner_flags & ImDrawFlags_RoundCornersBottomLeft };
+    const int corners_cell[4][2] = { { 0, 0 }, { 2, 0 }, { 2, 2 }, { 0, 2 } };
+    int vtx_count = 16;
+    for (int corner_n = 0; corner_n < 4; corner_n++)
+        if (!corners_rounded[corner_n])
+            vtx_count++;
+    PrimReserve(9 * 6, vtx_count);
+
+    ImDrawVert* vtx0 = _VtxWritePtr;
+    const unsigned int idx0 = _VtxCurrentIdx;
+    for (int y = 0; y < 4; y++)
+        for (int x = 0; x < 4; x++)
+        {
+            _VtxWritePtr[0].pos.x = grid_x[x]; _VtxWritePtr[0].pos.y = grid_y[y]; _VtxWritePtr[0].uv.x = grid_u[x]; _VtxWritePtr[0].uv.y = grid_v[y]; _VtxWritePtr[0].col = col;
+            _VtxWritePtr++;
+        }
+
+    // Edge and center cells
+    for (int cell_y = 0; cell_y < 3; cell_y++)
+        for (int cell_x = 0; cell_x < 3; cell_x++)
+        {
+            if (cell_x != 1 && cell_y != 1)
+                continue;
+            const unsigned int idx = idx0 + cell_y * 4 + cell_x;
+            _IdxWritePtr[0] = (ImDrawIdx)(idx); _IdxWritePtr[1] = (ImDrawIdx)(idx + 1); _IdxWritePtr[2] = (ImDrawIdx)(idx + 5);
+            _IdxWritePtr[3] = (ImDrawIdx)(idx); _IdxWritePtr[4] = (ImDrawIdx)(idx + 5); _IdxWritePtr[5] = (ImDrawIdx)(idx + 4);
+            _IdxWritePtr += 6;
+        }
+
+    // Corner cells, split along the diagonal between the outer corner and the corner center.
+    // Non-rounded corners sample coverage along the horizontal axis on one side of the diagonal and the vertical axis on the other side,
+    // which requires a second vertex at the outer corner.
+    unsigned int idx_extra = idx0 + 16;
+    for (int corner_n = 0; corner_n < 4; corner_n++)
+    {
+        const int outer_x = corners_cell[corner_n][0] == 0 ? 0 : 3;
+        const int outer_y = corners_cell[corner_n][1] == 0 ? 0 : 3;
+        const int inner_x = corners_cell[corner_n][0] == 0 ? 1 : 2;
+        const int inner_y = corners_cell[corner_n][1] == 0 ? 1 : 2;
+        const unsigned int idx_outer = idx0 + outer_y * 4 + outer_x;
+        const unsigned int idx_inner = idx0 + inner_y * 4 + inner_x;
+        unsigned int idx_outer_2 = idx_outer;
+        if (!corners_rounded[corner_n])
+        {
+            ImDrawVert* vtx_outer = &vtx0[outer_y * 4 + outer_x];
+            vtx_outer->uv.y = grid_v[inner_y];
+            _VtxWritePtr[0].pos = vtx_outer->pos; _VtxWritePtr[0].uv.x = grid_u[inner_x]; _VtxWritePtr[0].uv.y = grid_v[outer_y]; _VtxWritePtr[0].col = col;
+            _VtxWritePtr++;
+            idx_outer_2 = idx_extra++;
+        }
+        _IdxWritePtr[0] = (ImDrawIdx)(idx_inner); _IdxWritePtr[1] = (ImDrawIdx)(idx0 + inner_y * 4 + outer_x); _IdxWritePtr[2] = (ImDrawIdx)(idx_outer);
+        _IdxWritePtr[3] = (ImDrawIdx)(idx_inner); _IdxWritePtr[4] = (ImDrawIdx)(idx_outer_2); _IdxWritePtr[5] = (ImDrawIdx)(idx0 + outer_y * 4 + inner_x);
+        _IdxWritePtr += 6;
     }
+    _VtxCurrentIdx += vtx_count;
 }
 
 // p_min = upper-left, p_max = lower-right
@@ -1416,6 +1705,8 @@ void ImDrawList::AddRectFilledMultiColor(const ImVec2& p_min, const ImVec2& p_ma
 {
     if (((col_upr_left | col_upr_right | col_bot_right | col_bot_left) & IM_COL32_A_MASK) == 0)
         return;
+    if (IsCoarseClipped(this, p_min, p_max, 0.0f))
+        return;
 
     const ImVec2 uv = _Data->TexUvWhitePixel;
     PrimReserve(6, 4);
@@ -1431,52 +1722,69 @@ void ImDrawList::AddQuad(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, c
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (IsCoarseClipped(this, ImMin(ImMin(p1, p2), ImMin(p3, p4)), ImMax(ImMax(p1, p2), ImMax(p3, p4)), IM_COARSE_CLIP_MITER_PAD(thickness, _FringeScale)))
+        return;
 
     PathLineTo(p1);
     PathLineTo(p2);
     PathLineTo(p3);
     PathLineTo(p4);
-    PathStroke(col, ImDrawFlags_Closed, thickness);
+    _PathStroke(col, ImDrawFlags_Closed, thickness);
 }
 
 void ImDrawList::AddQuadFilled(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, ImU32 col)
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (IsCoarseClipped(this, ImMin(ImMin(p1, p2), ImMin(p3, p4)), ImMax(ImMax(p1, p2), ImMax(p3, p4)), 0.0f))
+        return;
 
     PathLineTo(p1);
     PathLineTo(p2);
     PathLineTo(p3);
     PathLineTo(p4);
-    PathFillConvex(col);
+    _PathFillConvex(col);
 }
 
 void ImDrawList::AddTriangle(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, ImU32 col, float thickness)
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (IsCoarseClipped(this, ImMin(ImMin(p1, p2), p3), ImMax(ImMax(p1, p2), p3), IM_COARSE_CLIP_MITER_PAD(thickness, _FringeScale)))
+        return;
 
     PathLineTo(p1);
     PathLineTo(p2);
     PathLineTo(p3);
-    PathStroke(col, ImDrawFlags_Closed, thickness);
+    _PathStroke(col, ImDrawFlags_Closed, thickness);
 }
 
 void ImDrawList::AddTriangleFilled(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, ImU32 col)
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (IsCoarseClipped(this, ImMin(ImMin(p1, p2), p3), ImMax(ImMax(p1, p2), p3), 0.0f))
+        return;
 
     PathLineTo(p1);
     PathLineTo(p2);
     PathLineTo(p3);
-    PathFillConvex(col);
+    _PathFillConvex(col);
 }
 
 void ImDrawList::AddCircle(const ImVec2& center, float radius, ImU32 col, int num_segments, float thickness)
 {
     if ((col & IM_COL32_A_MASK) == 0 || radius < 0.5f)
         return;
+    if (IsCoarseClipped(this, ImVec2(center.x - radius, center.y - radius), ImVec2(center.x + radius, center.y + radius), thickness))
+        return;
+
+    if (num_segments <= 0 && (Flags & (ImDrawListFlags_ShapeInstances | ImDrawListFlags_AllowShapes)) == (ImDrawListFlags_ShapeInstances | ImDrawListFlags_AllowShapes))
+    {
+        const float r = radius - 0.5f;
+        _AddShape(ImVec2(center.x - r, center.y - r), ImVec2(center.x + r, center.y + r), col, r, thickness);
+        return;
+    }
 
     if (num_segments <= 0)
     {
@@ -1494,13 +1802,49 @@ void ImDrawList::AddCircle(const ImVec2& center, float radius, ImU32 col, int nu
         PathArcTo(center, radius - 0.5f, 0.0f, a_max, num_segments - 1);
     }
 
-    PathStroke(col, ImDrawFlags_Closed, thickness);
+    _PathStroke(col, ImDrawFlags_Closed, thickness);
 }
 
 void ImDrawList::AddCircleFilled(const ImVec2& center, float radius, ImU32 col, int num_segments)
 {
     if ((col & IM_COL32_A_MASK) == 0 || radius < 0.5f)
         return;
+    if (IsCoarseClipped(this, ImVec2(center.x - radius, center.y - radius), ImVec2(center.x + radius, center.y + radius), 0.0f))
+        return;
+
+    if (num_segments <= 0 && (Flags & (ImDrawListFlags_ShapeInstances | ImDrawListFlags_AllowShapes)) == (ImDrawListFlags_ShapeInstances | ImDrawListFlags_AllowShapes))
+    {
+        _AddShape(ImVec2(center.x - radius, center.y - radius), ImVec2(center.x + radius, center.y + radius), col, radius, 0.0f);
+        return;
+    }
+
+    const ImVec4* tex_uvs = (num_segments <= 0) ? GetTexUvRoundCorners(this, radius) : NULL;
+    if (tex_uvs != NULL)
+    {
+        // Use baked quarter disc: 4 quads sharing the center vertex, mirrored by UV (see ImFontAtlasBuildRenderRoundCornersTexData())
+        const float grid_x[3] = { center.x - radius - 1.0f, center.x, center.x + radius + 1.0f };
+        const float grid_y[3] = { center.y - radius - 1.0f, center.y, center.y + radius + 1.0f };
+        const float grid_u[3] = { tex_uvs->z, tex_uvs->x, tex_uvs->z };
+        const float grid_v[3] = { tex_uvs->w, tex_uvs->y, tex_uvs->w };
+        PrimReserve(4 * 6, 9);
+        const unsigned int idx0 = _VtxCurrentIdx;
+        for (int y = 0; y < 3; y++)
+            for (int x = 0; x < 3; x++)
+            {
+                _VtxWritePtr[0].pos.x = grid_x[x]; _VtxWritePtr[0].pos.y = grid_y[y]; _VtxWritePtr[0].uv.x = grid_u[x]; _VtxWritePtr[0].uv.y = grid_v[y]; _VtxWritePtr[0].col = col;
+                _VtxWritePtr++;
+            }
+        for (int cell_y = 0; cell_y < 2; cell_y++)
+            for (int cell_x = 0; cell_x < 2; cell_x++)
+            {
+                const unsigned int idx = idx0 + cell_y * 3 + cell_x;
+                _IdxWritePtr[0] = (ImDrawIdx)(idx); _IdxWritePtr[1] = (ImDrawIdx)(idx + 1); _IdxWritePtr[2] = (ImDrawIdx)(idx + 4);
+                _IdxWritePtr[3] = (ImDrawIdx)(idx); _IdxWritePtr[4] = (ImDrawIdx)(idx + 4); _IdxWritePtr[5] = (ImDrawIdx)(idx + 3);
+                _IdxWritePtr += 6;
+            }
+        _VtxCurrentIdx += 9;
+        return;
+    }
 
     if (num_segments <= 0)
     {
@@ -1518,7 +1862,7 @@ void ImDrawList::AddCircleFilled(const ImVec2& center, float radius, ImU32 col,
         PathArcTo(center, radius, 0.0f, a_max, num_segments - 1);
     }
 
-    PathFillConvex(col);
+    _PathFillConvex(col);
 }
 
 // Guaranteed to honor 'num_segments'
@@ -1526,11 +1870,13 @@ void ImDrawList::AddNgon(const ImVec2& center, float radius, ImU32 col, int num_
 {
     if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
         return;
+    if (IsCoarseClipped(this, ImVec2(center.x - radius, center.y - radius), ImVec2(center.x + radius, center.y + radius), thickness + _FringeScale)) // Corners are >= 60 degrees, miters extend up to twice half thickness
+        return;
 
     // Because we are filling a closed shape we remove 1 from the count of segments/points
     const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
     PathArcTo(center, radius - 0.5f, 0.0f, a_max, num_segments - 1);
-    PathStroke(col, ImDrawFlags_Closed, thickness);
+    _PathStroke(col, ImDrawFlags_Closed, thickness);
 }
 
 // Guaranteed to honor 'num_segments'
@@ -1538,11 +1884,13 @@ void ImDrawList::AddNgonFilled(const ImVec2& center, float radius, ImU32 col, in
 {
     if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
         return;
+    if (IsCoarseClipped(this, ImVec2(center.x - radius, center.y - radius), ImVec2(center.x + radius, center.y + radius), 0.0f))
+        return;
 
     // Because we are filling a closed shape we remove 1 from the count of segments/points
     const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
     PathArcTo(center, radius, 0.0f, a_max, num_segments - 1);
-    PathFillConvex(col);
+    _PathFillConvex(col);
 }
 
 // Cubic Bezier takes 4 controls points
@@ -1550,10 +1898,12 @@ void ImDrawList::AddBezierCubic(const ImVec2& p1, const ImVec2& p2, const ImVec2
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (IsCoarseClipped(this, ImMin(ImMin(p1, p2), ImMin(p3, p4)), ImMax(ImMax(p1, p2), ImMax(p3, p4)), IM_COARSE_CLIP_MITER_PAD(thickness, _FringeScale))) // Curve is within the convex hull of its control points
+        return;
 
     PathLineTo(p1);
     PathBezierCubicCurveTo(p2, p3, p4, num_segments);
-    PathStroke(col, 0, thickness);
+    _PathStroke(col, 0, thickness);
 }
 
 // Quadratic Bezier takes 3 controls points
@@ -1561,10 +1911,12 @@ void ImDrawList::AddBezierQuadratic(const ImVec2& p1, const ImVec2& p2, const Im
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (IsCoarseClipped(this, ImMin(ImMin(p1, p2), p3), ImMax(ImMax(p1, p2), p3), IM_COARSE_CLIP_MITER_PAD(thickness, _FringeScale))) // Curve is within the convex hull of its control points
+        return;
 
     PathLineTo(p1);
     PathBezierQuadraticCurveTo(p2, p3, num_segments);
-    PathStroke(col, 0, thickness);
+    _PathStroke(col, 0, thickness);
 }
 
 void ImDrawList::AddText(const ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end, float wrap_width, const ImVec4* cpu_fine_clip_rect)
@@ -1582,6 +1934,8 @@ void ImDrawList::AddText(const ImFont* font, float font_size, const ImVec2& pos,
         font = _Data->Font;
     if (font_size == 0.0f)
         font_size = _Data->FontSize;
+    if (font->DeferredGlyphs)
+        const_cast<ImFont*>(font)->LoadDeferredGlyphs(); // First use of a ImFontConfig::Deferred font
 
     IM_ASSERT(font->ContainerAtlas->TexID == _CmdHeader.TextureId);  // Use high-level ImGui::PushFont() or low-level ImDrawList::PushTextureId() to change font.
 
@@ -1605,6 +1959,8 @@ void ImDrawList::AddImage(ImTextureID user_texture_id, const ImVec2& p_min, cons
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (IsCoarseClipped(this, p_min, p_max, 0.0f))
+        return;
 
     const bool push_texture_id = user_texture_id != _CmdHeader.TextureId;
     if (push_texture_id)
@@ -1621,6 +1977,8 @@ void ImDrawList::AddImageQuad(ImTextureID user_texture_id, const ImVec2& p1, con
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (IsCoarseClipped(this, ImMin(ImMin(p1, p2), ImMin(p3, p4)), ImMax(ImMax(p1, p2), ImMax(p3, p4)), 0.0f))
+        return;
 
     const bool push_texture_id = user_texture_id != _CmdHeader.TextureId;
     if (push_texture_id)
@@ -1637,6 +1995,8 @@ void ImDrawList::AddImageRounded(ImTextureID user_texture_id, const ImVec2& p_mi
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (IsCoarseClipped(this, p_min, p_max, 0.0f))
+        return;
 
     flags = FixRectCornerFlags(flags);
     if (rounding < 0.5f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
@@ -1651,7 +2011,7 @@ void ImDrawList::AddImageRounded(ImTextureID user_texture_id, const ImVec2& p_mi
 
     int vert_start_idx = VtxBuffer.Size;
     PathRect(p_min, p_max, rounding, flags);
-    PathFillConvex(col);
+    _PathFillConvex(col);
     int vert_end_idx = VtxBuffer.Size;
     ImGui::ShadeVertsLinearUV(this, vert_start_idx, vert_end_idx, p_min, p_max, uv_min, uv_max, true);
 
@@ -1735,7 +2095,7 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
             // Do not include ImDrawCmd_AreSequentialIdxOffset() in the compare as we rebuild IdxOffset values ourselves.
             // Manipulating IdxOffset (e.g. by reordering draw commands like done by RenderDimmedBackgroundBehindWindow()) is not supported within a splitter.
             ImDrawCmd* next_cmd = &ch._CmdBuffer[0];
-            if (ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL)
+            if (ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL && last_cmd->ShapeCount == 0 && next_cmd->ShapeCount == 0)
             {
                 // Merge previous channel last draw command with current channel first draw command if matching.
                 last_cmd->ElemCount += next_cmd->ElemCount;
@@ -1812,8 +2172,11 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
 void ImDrawData::Clear()
 {
     Valid = false;
-    CmdListsCount = TotalIdxCount = TotalVtxCount = 0;
+    CmdListsCount = TotalIdxCount = TotalVtxCount = TotalShapeCount = 0;
+    Fingerprint = 0;
+    Unchanged = false;
     CmdLists.resize(0); // The ImDrawList are NOT owned by ImDrawData but e.g. by ImGuiContext, so we don't clear them.
+    DirtyRects.resize(0);
     DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.0f, 0.0f);
     OwnerViewport = NULL;
 }
@@ -1824,7 +2187,7 @@ void ImGui::AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>
 {
     if (draw_list->CmdBuffer.Size == 0)
         return;
-    if (draw_list->CmdBuffer.Size == 1 && draw_list->CmdBuffer[0].ElemCount == 0 && draw_list->CmdBuffer[0].UserCallback == NULL)
+    if (draw_list->CmdBuffer.Size == 1 && draw_list->CmdBuffer[0].ElemCount == 0 && draw_list->CmdBuffer[0].UserCallback == NULL && draw_list->CmdBuffer[0].ShapeCount == 0)
         return;
 
     // Draw list sanity check. Detect mismatch between PrimReserve() calls and incrementing _VtxCurrentIdx, _VtxWritePtr etc.
@@ -1857,58 +2220,425 @@ void ImGui::AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>
     draw_data->CmdListsCount++;
     draw_data->TotalVtxCount += draw_list->VtxBuffer.Size;
     draw_data->TotalIdxCount += draw_list->IdxBuffer.Size;
+    draw_data->TotalShapeCount += draw_list->ShapeBuffer.Size;
 }
 
-void ImDrawData::AddDrawList(ImDrawList* draw_list)
+// Hash contents of a draw list (buffers and command headers). User callbacks may render anything so they are reported in 'out_has_callbacks'.
+static ImU64 CalcDrawListContentHash(const ImDrawList* draw_list, bool* out_has_callbacks)
 {
-    IM_ASSERT(CmdLists.Size == CmdListsCount);
-    draw_list->_PopUnusedDrawCmd();
-    ImGui::AddDrawListToDrawDataEx(this, &CmdLists, draw_list);
+    ImU64 hash = ImHashData64(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.Size * sizeof(ImDrawVert));
+    hash = ImHashData64(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.Size * sizeof(ImDrawIdx), hash);
+    hash = ImHashData64(draw_list->ShapeBuffer.Data, (size_t)draw_list->ShapeBuffer.Size * sizeof(ImDrawShape), hash);
+    *out_has_callbacks = false;
+    for (int cmd_n = 0; cmd_n < draw_list->CmdBuffer.Size; cmd_n++)
+    {
+        // Hash fields individually as ImDrawCmd may have padding
+        const ImDrawCmd* cmd = &draw_list->CmdBuffer[cmd_n];
+        const unsigned int offsets[5] = { cmd->VtxOffset, cmd->IdxOffset, cmd->ElemCount, cmd->ShapeOffset, cmd->ShapeCount };
+        hash = ImHashData64(&cmd->ClipRect, sizeof(cmd->ClipRect), hash);
+        hash = ImHashData64(&cmd->TextureId, sizeof(cmd->TextureId), hash);
+        hash = ImHashData64(offsets, sizeof(offsets), hash);
+        if (cmd->UserCallback != NULL && cmd->UserCallback != ImDrawCallback_ResetRenderState)
+            *out_has_callbacks = true;
+    }
+    return hash;
 }
 
-// For backward compatibility: convert all buffers from indexed to de-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
-void ImDrawData::DeIndexAllBuffers()
+// Calculate the screen bounds of a draw list output.
+static ImRect CalcDrawListBounds(const ImDrawList* draw_list, bool always_dirty)
 {
-    ImVector<ImDrawVert> new_vtx_buffer;
-    TotalVtxCount = TotalIdxCount = 0;
-    for (int i = 0; i < CmdListsCount; i++)
+    ImRect clip_bb(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (int cmd_n = 0; cmd_n < draw_list->CmdBuffer.Size; cmd_n++)
+        clip_bb.Add(ImRect(draw_list->CmdBuffer[cmd_n].ClipRect));
+    if (always_dirty)
+        return clip_bb;
+
+    // Output is within the vertices and shapes bounds, clipped
+    ImRect bb(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (int n = 0; n < draw_list->VtxBuffer.Size; n++)
     {
-        ImDrawList* cmd_list = CmdLists[i];
-        if (cmd_list->IdxBuffer.empty())
-            continue;
-        new_vtx_buffer.resize(cmd_list->IdxBuffer.Size);
-        for (int j = 0; j < cmd_list->IdxBuffer.Size; j++)
-            new_vtx_buffer[j] = cmd_list->VtxBuffer[cmd_list->IdxBuffer[j]];
-        cmd_list->VtxBuffer.swap(new_vtx_buffer);
-        cmd_list->IdxBuffer.resize(0);
-        TotalVtxCount += cmd_list->VtxBuffer.Size;
+        const ImVec2 pos = draw_list->VtxBuffer.Data[n].pos;
+        bb.Min.x = ImMin(bb.Min.x, pos.x); bb.Min.y = ImMin(bb.Min.y, pos.y);
+        bb.Max.x = ImMax(bb.Max.x, pos.x); bb.Max.y = ImMax(bb.Max.y, pos.y);
     }
+    for (int n = 0; n < draw_list->ShapeBuffer.Size; n++)
+        bb.Add(ImRect(draw_list->ShapeBuffer.Data[n].Min - ImVec2(1.0f, 1.0f), draw_list->ShapeBuffer.Data[n].Max + ImVec2(1.0f, 1.0f)));
+    if (bb.Min.x <= bb.Max.x && clip_bb.Min.x <= clip_bb.Max.x)
+        bb.ClipWithFull(clip_bb);
+    return bb;
 }
 
-// Helper to scale the ClipRect field of each ImDrawCmd.
-// Use if your final output buffer is at a different scale than draw_data->DisplaySize,
-// or if there is a difference between your window resolution and framebuffer resolution.
-void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
+static bool IsDrawListHashEntryReusable(const ImDrawListHashEntry* entry, const ImDrawListHashEntry* prev_entry)
 {
-    for (int i = 0; i < CmdListsCount; i++)
+    return prev_entry->ContentHash != 0 && entry->ResetStamp != 0 && entry->DrawList == prev_entry->DrawList && entry->ResetStamp == prev_entry->ResetStamp && entry->VtxData == prev_entry->VtxData
+        && entry->CmdCount == prev_entry->CmdCount && entry->IdxCount == prev_entry->IdxCount && entry->VtxCount == prev_entry->VtxCount && entry->ShapeCount == prev_entry->ShapeCount;
+}
+
+static bool IsDrawListHashEntrySameSizes(const ImDrawListHashEntry* entry, const ImDrawListHashEntry* prev_entry)
+{
+    return entry->CmdCount == prev_entry->CmdCount && entry->IdxCount == prev_entry->IdxCount && entry->VtxCount == prev_entry->VtxCount && entry->ShapeCount == prev_entry->ShapeCount;
+}
+
+// Record draw lists of 'draw_data' into tracker->Entries, moving the previous update into tracker->PrevEntries. Once per frame.
+// - Draw lists which weren't reset nor resized since the previous update (e.g. lists kept by the application) reuse their hash and bounds instead of reading their buffers again.
+// - Unless 'hash_all' is set, only lists with the same sizes as the list at the same position on the previous frame are hashed, as others can't be unchanged.
+// - With 'calc_bounds', screen bounds of every list are calculated.
+static void UpdateDrawListHashEntries(ImDrawData* draw_data, ImDrawDataDirtyTracker* tracker, int frame_count, bool hash_all, bool calc_bounds)
+{
+    if (tracker->EntriesFrame == frame_count)
+        return;
+    tracker->PrevEntries.swap(tracker->Entries);
+    tracker->PrevEntriesFrame = tracker->EntriesFrame;
+    tracker->EntriesFrame = frame_count;
+
+    ImVector<ImDrawListHashEntry>& entries = tracker->Entries;
+    const ImVector<ImDrawListHashEntry>& prev_entries = tracker->PrevEntries;
+    const bool prev_is_last_frame = (tracker->PrevEntriesFrame == frame_count - 1);
+    entries.resize(draw_data->CmdListsCount);
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
-        ImDrawList* cmd_list = CmdLists[i];
-        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        const ImDrawList* draw_list = draw_data->CmdLists[n];
+        ImDrawListHashEntry* entry = &entries[n];
+        memset(entry, 0, sizeof(*entry));
+        entry->DrawList = draw_list;
+        entry->VtxData = draw_list->VtxBuffer.Data;
+        entry->ResetStamp = draw_list->_ResetStamp;
+        entry->CmdCount = draw_list->CmdBuffer.Size;
+        entry->IdxCount = draw_list->IdxBuffer.Size;
+        entry->VtxCount = draw_list->VtxBuffer.Size;
+        entry->ShapeCount = draw_list->ShapeBuffer.Size;
+
+        // Reuse previous update of an unmodified list. Lists are generally in the same order, so we only search when it moved.
+        const ImDrawListHashEntry* prev_entry = NULL;
+        if (n < prev_entries.Size && IsDrawListHashEntryReusable(entry, &prev_entries[n]))
+            prev_entry = &prev_entries[n];
+        for (int prev_n = 0; prev_n < prev_entries.Size && prev_entry == NULL; prev_n++)
+            if (IsDrawListHashEntryReusable(entry, &prev_entries[prev_n]))
+                prev_entry = &prev_entries[prev_n];
+        if (prev_entry != NULL)
         {
-            ImDrawCmd* cmd = &cmd_list->CmdBuffer[cmd_i];
-            cmd->ClipRect = ImVec4(cmd->ClipRect.x * fb_scale.x, cmd->ClipRect.y * fb_scale.y, cmd->ClipRect.z * fb_scale.x, cmd->ClipRect.w * fb_scale.y);
+            entry->ContentHash = prev_entry->ContentHash;
+            entry->AlwaysDirty = prev_entry->AlwaysDirty;
+            entry->Bounds = prev_entry->Bounds;
+            entry->HasBounds = prev_entry->HasBounds;
+        }
+        else if (hash_all || (prev_is_last_frame && n < prev_entries.Size && IsDrawListHashEntrySameSizes(entry, &prev_entries[n])))
+        {
+            entry->ContentHash = CalcDrawListContentHash(draw_list, &entry->AlwaysDirty);
+            entry->ContentHash = (entry->ContentHash != 0) ? entry->ContentHash : 1; // 0 is reserved for 'not computed'
+        }
+        if (calc_bounds && !entry->HasBounds && entry->ContentHash != 0)
+        {
+            entry->Bounds = CalcDrawListBounds(draw_list, entry->AlwaysDirty);
+            entry->HasBounds = true;
         }
     }
 }
 
-//-----------------------------------------------------------------------------
-// [SECTION] Helpers ShadeVertsXXX functions
-//-----------------------------------------------------------------------------
+static void AddDirtyRect(ImVector<ImVec4>* dirty_rects, ImRect rect, const ImRect& display_rect)
+{
+    rect.Min = ImVec2(ImFloorSigned(rect.Min.x), ImFloorSigned(rect.Min.y));
+    rect.Max = ImVec2(-ImFloorSigned(-rect.Max.x), -ImFloorSigned(-rect.Max.y));
+    rect.ClipWithFull(display_rect);
+    if (rect.Min.x >= rect.Max.x || rect.Min.y >= rect.Max.y)
+        return;
 
-// Generic linear color gradient, write to RGB fields, leave A untouched.
-void ImGui::ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1)
+    // Merge with overlapping rectangles, which may then overlap other rectangles
+    for (int n = 0; n < dirty_rects->Size; n++)
+    {
+        if (!rect.Overlaps(ImRect((*dirty_rects)[n])))
+            continue;
+        rect.Add(ImRect((*dirty_rects)[n]));
+        dirty_rects->erase(dirty_rects->Data + n);
+        n = -1;
+    }
+    dirty_rects->push_back(rect.ToVec4());
+}
+
+// Compare draw lists of 'draw_data' with the ones of the previous frame stored in 'tracker', and output screen rectangles which changed into draw_data->DirtyRects.
+// - Each draw list is identified by a hash of its buffers, combined with the hashes of the lists below it which overlap it, so reordering overlapping lists make them dirty.
+// - Bounds of draw lists which appeared or disappeared since the previous frame are added to the dirty rectangles. Overlapping dirty rectangles are merged.
+// - Lists with user callbacks are always dirty. The whole display is dirty if the previous update wasn't on the previous frame or display changed.
+// Used by Render() when io.ConfigDrawDataDirtyRects is set. Call before UpdateDrawDataFingerprint() and MergeDrawDataLists().
+void ImGui::UpdateDrawDataDirtyRects(ImDrawData* draw_data, ImDrawDataDirtyTracker* tracker, int frame_count)
 {
-    ImVec2 gradient_extent = gradient_p1 - gradient_p0;
+    const ImRect display_rect(draw_data->DisplayPos, draw_data->DisplayPos + draw_data->DisplaySize);
+    UpdateDrawListHashEntries(draw_data, tracker, frame_count, true, true);
+    ImVector<ImDrawListHashEntry>& entries = tracker->Entries;
+    const ImVector<ImDrawListHashEntry>& prev_entries = tracker->PrevEntries;
+    for (int n = 0; n < entries.Size; n++)
+    {
+        ImDrawListHashEntry* entry = &entries[n];
+        entry->Hash = entry->ContentHash;
+        for (int below_n = 0; below_n < n; below_n++)
+            if (entries[below_n].Bounds.Overlaps(entry->Bounds))
+                entry->Hash = ImHashData64(&entries[below_n].ContentHash, sizeof(ImU64), entry->Hash);
+    }
+
+    draw_data->DirtyRects.resize(0);
+    bool full_redraw = tracker->LastFrame != frame_count - 1 || tracker->PrevEntriesFrame != frame_count - 1;
+    full_redraw |= tracker->DisplayPos.x != draw_data->DisplayPos.x || tracker->DisplayPos.y != draw_data->DisplayPos.y;
+    full_redraw |= tracker->DisplaySize.x != draw_data->DisplaySize.x || tracker->DisplaySize.y != draw_data->DisplaySize.y;
+    full_redraw |= tracker->FramebufferScale.x != draw_data->FramebufferScale.x || tracker->FramebufferScale.y != draw_data->FramebufferScale.y;
+    if (full_redraw)
+    {
+        AddDirtyRect(&draw_data->DirtyRects, display_rect, display_rect);
+    }
+    else
+    {
+        // Draw lists counts are generally small (one per visible window), so we don't bother with a faster lookup.
+        for (int pass = 0; pass < 2; pass++)
+        {
+            const ImVector<ImDrawListHashEntry>& src_entries = (pass == 0) ? entries : prev_entries;
+            const ImVector<ImDrawListHashEntry>& other_entries = (pass == 0) ? prev_entries : entries;
+            for (int n = 0; n < src_entries.Size; n++)
+            {
+                const ImDrawListHashEntry* entry = &src_entries[n];
+                bool found = false;
+                for (int other_n = 0; other_n < other_entries.Size && !found && !entry->AlwaysDirty; other_n++)
+                    found = (other_entries[other_n].Hash == entry->Hash);
+                if (!found)
+                    AddDirtyRect(&draw_data->DirtyRects, entry->Bounds, display_rect);
+            }
+        }
+    }
+
+    tracker->LastFrame = frame_count;
+    tracker->DisplayPos = draw_data->DisplayPos;
+    tracker->DisplaySize = draw_data->DisplaySize;
+    tracker->FramebufferScale = draw_data->FramebufferScale;
+}
+
+// Calculate draw_data->Fingerprint, a hash of its draw lists and display settings, and set draw_data->Unchanged if it matches the previous frame.
+// - Unchanged requires every draw list to have the same sizes and 64-bit hash as the draw list at the same position on the previous frame, on top of the same fingerprint.
+// - Lists which changed sizes since the previous frame can't be unchanged: they aren't hashed, and Fingerprint is left to 0 for this frame,
+//   unless hashes were computed by UpdateDrawDataDirtyRects() called on the same frame.
+// - Lists which weren't reset nor resized since the previous frame reuse their hash (see UpdateDrawListHashEntries()).
+// - Lists with user callbacks are never unchanged. Changes of textures contents are not detected.
+// Used by Render() when io.ConfigDrawDataFingerprint is set.
+void ImGui::UpdateDrawDataFingerprint(ImDrawData* draw_data, ImDrawDataDirtyTracker* tracker, int frame_count)
+{
+    UpdateDrawListHashEntries(draw_data, tracker, frame_count, false, false);
+    const ImVector<ImDrawListHashEntry>& entries = tracker->Entries;
+    const ImVector<ImDrawListHashEntry>& prev_entries = tracker->PrevEntries;
+    const ImU64 prev_fingerprint = (tracker->FingerprintLastFrame == frame_count - 1) ? tracker->Fingerprint : 0;
+    bool unchanged = prev_fingerprint != 0 && tracker->PrevEntriesFrame == frame_count - 1 && entries.Size == prev_entries.Size;
+
+    const float display[6] = { draw_data->DisplayPos.x, draw_data->DisplayPos.y, draw_data->DisplaySize.x, draw_data->DisplaySize.y, draw_data->FramebufferScale.x, draw_data->FramebufferScale.y };
+    ImU64 fingerprint = ImHashData64(display, sizeof(display));
+    bool all_hashed = true;
+    for (int n = 0; n < entries.Size && all_hashed; n++)
+    {
+        const ImDrawListHashEntry* entry = &entries[n];
+        all_hashed = (entry->ContentHash != 0);
+        fingerprint = ImHashData64(&entry->ContentHash, sizeof(ImU64), fingerprint);
+        if (unchanged)
+            unchanged = all_hashed && !entry->AlwaysDirty && IsDrawListHashEntrySameSizes(entry, &prev_entries[n]) && entry->ContentHash == prev_entries[n].ContentHash;
+    }
+    if (!all_hashed)
+        fingerprint = 0;
+    else if (fingerprint == 0)
+        fingerprint = 1; // 0 is reserved for 'not computed'
+
+    draw_data->Fingerprint = fingerprint;
+    draw_data->Unchanged = unchanged && fingerprint == prev_fingerprint;
+    tracker->Fingerprint = fingerprint;
+    tracker->FingerprintLastFrame = frame_count;
+}
+
+// Bounding box of the vertices referenced by a draw command.
+static ImRect CalcDrawCmdVtxBounds(const ImDrawList* draw_list, const ImDrawCmd* cmd)
+{
+    ImRect bb(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + cmd->VtxOffset;
+    const ImDrawIdx* idx_buffer = draw_list->IdxBuffer.Data + cmd->IdxOffset;
+    for (unsigned int n = 0; n < cmd->ElemCount; n++)
+    {
+        const ImVec2 pos = vtx_buffer[idx_buffer[n]].pos;
+        bb.Min.x = ImMin(bb.Min.x, pos.x); bb.Min.y = ImMin(bb.Min.y, pos.y);
+        bb.Max.x = ImMax(bb.Max.x, pos.x); bb.Max.y = ImMax(bb.Max.y, pos.y);
+    }
+    return bb;
+}
+
+// Return true if a clip rectangle has no effect on triangles within 'vtx_bb'.
+// Backends convert clip rectangles to framebuffer space with (ClipRect - DisplayPos) * FramebufferScale, then cast to integer scissor rectangles,
+// either as min/max corners or as min corner + size (OpenGL flips Y and uses the max corner + size). Those casts may round either way,
+// so we test in framebuffer space against the smallest scissor rectangle any of them can produce.
+static inline float ImCeilSigned(float f) { return -ImFloorSigned(-f); }
+static bool IsDrawCmdUnclipped(const ImRect& vtx_bb, const ImVec4& clip_rect, const ImVec2& clip_off, const ImVec2& clip_scale)
+{
+    const ImVec2 clip_min((clip_rect.x - clip_off.x) * clip_scale.x, (clip_rect.y - clip_off.y) * clip_scale.y);
+    const ImVec2 clip_max((clip_rect.z - clip_off.x) * clip_scale.x, (clip_rect.w - clip_off.y) * clip_scale.y);
+    if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
+        return false; // Backends skip commands with empty clip rectangles
+    const ImVec2 scissor_min(ImMax(ImCeilSigned(clip_min.x), ImCeilSigned(clip_max.x) - ImFloorSigned(clip_max.x - clip_min.x)), ImMax(ImCeilSigned(clip_min.y), ImCeilSigned(clip_max.y) - ImFloorSigned(clip_max.y - clip_min.y)));
+    const ImVec2 scissor_max(ImMin(ImFloorSigned(clip_max.x), ImFloorSigned(clip_min.x) + ImFloorSigned(clip_max.x - clip_min.x)), ImMin(ImFloorSigned(clip_max.y), ImFloorSigned(clip_min.y) + ImFloorSigned(clip_max.y - clip_min.y)));
+    const ImVec2 vtx_min((vtx_bb.Min.x - clip_off.x) * clip_scale.x, (vtx_bb.Min.y - clip_off.y) * clip_scale.y);
+    const ImVec2 vtx_max((vtx_bb.Max.x - clip_off.x) * clip_scale.x, (vtx_bb.Max.y - clip_off.y) * clip_scale.y);
+    return vtx_min.x >= scissor_min.x && vtx_min.y >= scissor_min.y && vtx_max.x <= scissor_max.x && vtx_max.y <= scissor_max.y;
+}
+
+// Merge consecutive draw lists of 'draw_data' into fewer draw lists (taken from and stored in 'merged_lists'), joining consecutive draw commands across lists.
+// - Vertices are appended and indices rebased. With 16-bit indices a new output list is started before exceeding 64K vertices.
+// - Two consecutive commands are joined when they share texture and clip rectangle, or when the vertices of one of them are within both scissor rectangles
+//   (computed from draw_data->DisplayPos and draw_data->FramebufferScale, which need to be set). This is typical of window backgrounds/decorations and contents which don't overflow their window.
+// - Draw lists using user callbacks or ImDrawCmd::VtxOffset are passed through unmodified and interrupt merging.
+// - Commands using shapes (ImDrawCmd::ShapeCount > 0) are copied but never joined.
+// Used by Render() when io.ConfigDrawDataMergeLists is set. Call after _PopUnusedDrawCmd() on every list.
+void ImGui::MergeDrawDataLists(ImDrawData* draw_data, ImVector<ImDrawList*>* merged_lists)
+{
+    ImVector<ImDrawList*>& cmd_lists = draw_data->CmdLists;
+    IM_ASSERT(cmd_lists.Size == draw_data->CmdListsCount);
+    const ImVec2 clip_off = draw_data->DisplayPos;
+    const ImVec2 clip_scale = draw_data->FramebufferScale;
+    int out_count = 0;              // Output lists are written in place, we never output more lists than we read.
+    int merged_lists_used = 0;
+    ImDrawList* dst_list = NULL;
+    ImRect dst_last_cmd_bb;
+    for (int src_list_n = 0; src_list_n < cmd_lists.Size; src_list_n++)
+    {
+        ImDrawList* src_list = cmd_lists[src_list_n];
+        bool can_merge = true;
+        for (int cmd_n = 0; cmd_n < src_list->CmdBuffer.Size && can_merge; cmd_n++)
+            if (src_list->CmdBuffer[cmd_n].UserCallback != NULL || src_list->CmdBuffer[cmd_n].VtxOffset != 0)
+                can_merge = false;
+        if (!can_merge)
+        {
+            cmd_lists[out_count++] = src_list;
+            dst_list = NULL;
+            continue;
+        }
+
+        // Start a new output list
+        if (dst_list == NULL || (sizeof(ImDrawIdx) == 2 && dst_list->VtxBuffer.Size + src_list->VtxBuffer.Size > (1 << 16)))
+        {
+            if (merged_lists_used == merged_lists->Size)
+                merged_lists->push_back(IM_NEW(ImDrawList)(src_list->_Data));
+            dst_list = (*merged_lists)[merged_lists_used++];
+            dst_list->CmdBuffer.resize(0);
+            dst_list->IdxBuffer.resize(0);
+            dst_list->VtxBuffer.resize(0);
+            dst_list->ShapeBuffer.resize(0);
+            dst_list->Flags = src_list->Flags;
+            dst_list->_OwnerName = "(Merged)";
+            cmd_lists[out_count++] = dst_list;
+        }
+
+        // Append buffers, rebasing indices
+        const unsigned int vtx_base = (unsigned int)dst_list->VtxBuffer.Size;
+        const unsigned int idx_base = (unsigned int)dst_list->IdxBuffer.Size;
+        const unsigned int shape_base = (unsigned int)dst_list->ShapeBuffer.Size;
+        dst_list->VtxBuffer.resize(dst_list->VtxBuffer.Size + src_list->VtxBuffer.Size);
+        memcpy(dst_list->VtxBuffer.Data + vtx_base, src_list->VtxBuffer.Data, (size_t)src_list->VtxBuffer.Size * sizeof(ImDrawVert));
+        dst_list->IdxBuffer.resize(dst_list->IdxBuffer.Size + src_list->IdxBuffer.Size);
+        ImDrawIdx* dst_idx = dst_list->IdxBuffer.Data + idx_base;
+        for (int n = 0; n < src_list->IdxBuffer.Size; n++)
+            dst_idx[n] = (ImDrawIdx)(src_list->IdxBuffer.Data[n] + vtx_base);
+        if (src_list->ShapeBuffer.Size > 0)
+        {
+            dst_list->ShapeBuffer.resize(dst_list->ShapeBuffer.Size + src_list->ShapeBuffer.Size);
+            memcpy(dst_list->ShapeBuffer.Data + shape_base, src_list->ShapeBuffer.Data, (size_t)src_list->ShapeBuffer.Size * sizeof(ImDrawShape));
+        }
+
+        // Append commands, joining them with the previous one when possible
+        for (int cmd_n = 0; cmd_n < src_list->CmdBuffer.Size; cmd_n++)
+        {
+            ImDrawCmd cmd = src_list->CmdBuffer[cmd_n];
+            if (cmd.ElemCount == 0 && cmd.ShapeCount == 0)
+                continue;
+            cmd.IdxOffset += idx_base;
+            cmd.ShapeOffset += shape_base;
+            const ImRect cmd_bb = CalcDrawCmdVtxBounds(dst_list, &cmd);
+            ImDrawCmd* prev_cmd = dst_list->CmdBuffer.Size > 0 ? &dst_list->CmdBuffer.back() : NULL;
+            if (prev_cmd != NULL && prev_cmd->TextureId == cmd.TextureId && prev_cmd->ShapeCount == 0 && cmd.ShapeCount == 0 && prev_cmd->IdxOffset + prev_cmd->ElemCount == cmd.IdxOffset)
+            {
+                bool join = memcmp(&prev_cmd->ClipRect, &cmd.ClipRect, sizeof(ImVec4)) == 0;
+                if (!join && IsDrawCmdUnclipped(dst_last_cmd_bb, prev_cmd->ClipRect, clip_off, clip_scale) && IsDrawCmdUnclipped(dst_last_cmd_bb, cmd.ClipRect, clip_off, clip_scale))
+                {
+                    // Previous command is unaffected by both clip rectangles: use the new one
+                    prev_cmd->ClipRect = cmd.ClipRect;
+                    join = true;
+                }
+                if (!join && IsDrawCmdUnclipped(cmd_bb, cmd.ClipRect, clip_off, clip_scale) && IsDrawCmdUnclipped(cmd_bb, prev_cmd->ClipRect, clip_off, clip_scale))
+                    join = true; // New command is unaffected by both clip rectangles: keep the previous one
+                if (join)
+                {
+                    prev_cmd->ElemCount += cmd.ElemCount;
+                    dst_last_cmd_bb.Add(cmd_bb);
+                    continue;
+                }
+            }
+            dst_list->CmdBuffer.push_back(cmd);
+            dst_last_cmd_bb = cmd_bb;
+        }
+    }
+    cmd_lists.resize(out_count);
+    draw_data->CmdListsCount = out_count;
+}
+
+void ImDrawData::AddDrawList(ImDrawList* draw_list)
+{
+    IM_ASSERT(CmdLists.Size == CmdListsCount);
+    draw_list->_PopUnusedDrawCmd();
+    ImGui::AddDrawListToDrawDataEx(this, &CmdLists, draw_list);
+}
+
+// For backward compatibility: convert all buffers from indexed to de-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
+void ImDrawData::DeIndexAllBuffers()
+{
+    ImVector<ImDrawVert> new_vtx_buffer;
+    TotalVtxCount = TotalIdxCount = 0;
+    for (int i = 0; i < CmdListsCount; i++)
+    {
+        ImDrawList* cmd_list = CmdLists[i];
+        if (cmd_list->IdxBuffer.empty())
+            continue;
+        new_vtx_buffer.resize(cmd_list->IdxBuffer.Size);
+        for (int j = 0; j < cmd_list->IdxBuffer.Size; j++)
+            new_vtx_buffer[j] = cmd_list->VtxBuffer[cmd_list->IdxBuffer[j]];
+        cmd_list->VtxBuffer.swap(new_vtx_buffer);
+        cmd_list->IdxBuffer.resize(0);
+        TotalVtxCount += cmd_list->VtxBuffer.Size;
+    }
+}
+
+// Helper to scale the ClipRect field of each ImDrawCmd.
+// Use if your final output buffer is at a different scale than draw_data->DisplaySize,
+// or if there is a difference between your window resolution and framebuffer resolution.
+void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
+{
+    for (int i = 0; i < CmdListsCount; i++)
+    {
+        ImDrawList* cmd_list = CmdLists[i];
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            ImDrawCmd* cmd = &cmd_list->CmdBuffer[cmd_i];
+            cmd->ClipRect = ImVec4(cmd->ClipRect.x * fb_scale.x, cmd->ClipRect.y * fb_scale.y, cmd->ClipRect.z * fb_scale.x, cmd->ClipRect.w * fb_scale.y);
+        }
+    }
+    for (int i = 0; i < DirtyRects.Size; i++)
+        DirtyRects[i] = ImVec4(DirtyRects[i].x * fb_scale.x, DirtyRects[i].y * fb_scale.y, DirtyRects[i].z * fb_scale.x, DirtyRects[i].w * fb_scale.y);
+}
+
+ImVec4 ImDrawData::GetDirtyRectsBounds() const
+{
+    if (DirtyRects.Size == 0)
+        return ImVec4(0.0f, 0.0f, 0.0f, 0.0f);
+    ImRect bb(DirtyRects[0]);
+    for (int i = 1; i < DirtyRects.Size; i++)
+        bb.Add(ImRect(DirtyRects[i]));
+    return bb.ToVec4();
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] Helpers ShadeVertsXXX functions
+//-----------------------------------------------------------------------------
+
+// Generic linear color gradient, write to RGB fields, leave A untouched.
+void ImGui::ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1)
+{
+    ImVec2 gradient_extent = gradient_p1 - gradient_p0;
     float gradient_inv_length2 = 1.0f / ImLengthSqr(gradient_extent);
     ImDrawVert* vert_start = draw_list->VtxBuffer.Data + vert_start_idx;
     ImDrawVert* vert_end = draw_list->VtxBuffer.Data + vert_end_idx;
@@ -1967,6 +2697,7 @@ ImFontConfig::ImFontConfig()
     GlyphMaxAdvanceX = FLT_MAX;
     RasterizerMultiply = 1.0f;
     EllipsisChar = (ImWchar)-1;
+    SDFPadding = 4;
 }
 
 //-----------------------------------------------------------------------------
@@ -2027,7 +2758,7 @@ ImFontAtlas::ImFontAtlas()
 {
     memset(this, 0, sizeof(*this));
     TexGlyphPadding = 1;
-    PackIdMouseCursors = PackIdLines = -1;
+    PackIdMouseCursors = PackIdLines = PackIdRoundCorners = -1;
 }
 
 ImFontAtlas::~ImFontAtlas()
@@ -2039,12 +2770,23 @@ ImFontAtlas::~ImFontAtlas()
 void    ImFontAtlas::ClearInputData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasBuildClearDynamicData(this); // Font builder may reference FontData
     for (int i = 0; i < ConfigData.Size; i++)
-        if (ConfigData[i].FontData && ConfigData[i].FontDataOwnedByAtlas)
+    {
+        ImFontConfig& cfg = ConfigData[i];
+        if (cfg.FontDataFile != NULL)
+        {
+            if (cfg.FontData)
+                ImFileUnmapFromMemory(cfg.FontData, (size_t)cfg.FontDataSize);
+            ImFileMapClose(cfg.FontDataFile);
+            cfg.FontDataFile = NULL;
+        }
+        else if (cfg.FontData && cfg.FontDataOwnedByAtlas)
         {
-            IM_FREE(ConfigData[i].FontData);
-            ConfigData[i].FontData = NULL;
+            IM_FREE(cfg.FontData);
         }
+        cfg.FontData = NULL;
+    }
 
     // When clearing this we lose access to the font name and other information used to build the font.
     for (int i = 0; i < Fonts.Size; i++)
@@ -2055,7 +2797,7 @@ void    ImFontAtlas::ClearInputData()
         }
     ConfigData.clear();
     CustomRects.clear();
-    PackIdMouseCursors = PackIdLines = -1;
+    PackIdMouseCursors = PackIdLines = PackIdRoundCorners = -1;
     // Important: we leave TexReady untouched
 }
 
@@ -2068,7 +2810,18 @@ void    ImFontAtlas::ClearTexData()
         IM_FREE(TexPixelsRGBA32);
     TexPixelsAlpha8 = NULL;
     TexPixelsRGBA32 = NULL;
+    for (int page_i = 0; page_i < TexExtraPages.Size; page_i++)
+    {
+        ImFontAtlasTexPage& page = TexExtraPages[page_i];
+        if (page.PixelsAlpha8)
+            IM_FREE(page.PixelsAlpha8);
+        if (page.PixelsRGBA32)
+            IM_FREE(page.PixelsRGBA32);
+        page.PixelsAlpha8 = NULL;
+        page.PixelsRGBA32 = NULL;
+    }
     TexPixelsUseColors = false;
+    ImFontAtlasBuildClearDynamicData(this); // Can't rasterize new glyphs without texture data
     // Important: we leave TexReady untouched
 }
 
@@ -2122,6 +2875,57 @@ void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_wid
     if (out_bytes_per_pixel) *out_bytes_per_pixel = 4;
 }
 
+void    ImFontAtlas::GetTexPageDataAsAlpha8(int page, unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel)
+{
+    if (page == 0)
+    {
+        GetTexDataAsAlpha8(out_pixels, out_width, out_height, out_bytes_per_pixel);
+        return;
+    }
+    IM_ASSERT(page > 0 && page < GetTexPageCount());
+    *out_pixels = TexExtraPages[page - 1].PixelsAlpha8;
+    if (out_width) *out_width = TexWidth;
+    if (out_height) *out_height = TexHeight;
+    if (out_bytes_per_pixel) *out_bytes_per_pixel = 1;
+}
+
+void    ImFontAtlas::GetTexPageDataAsRGBA32(int page, unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel)
+{
+    if (page == 0)
+    {
+        GetTexDataAsRGBA32(out_pixels, out_width, out_height, out_bytes_per_pixel);
+        return;
+    }
+
+    // Convert to RGBA32 format on demand
+    IM_ASSERT(page > 0 && page < GetTexPageCount());
+    ImFontAtlasTexPage& tex_page = TexExtraPages[page - 1];
+    if (!tex_page.PixelsRGBA32 && tex_page.PixelsAlpha8)
+    {
+        tex_page.PixelsRGBA32 = (unsigned int*)IM_ALLOC((size_t)TexWidth * (size_t)TexHeight * 4);
+        const unsigned char* src = tex_page.PixelsAlpha8;
+        unsigned int* dst = tex_page.PixelsRGBA32;
+        for (int n = TexWidth * TexHeight; n > 0; n--)
+            *dst++ = IM_COL32(255, 255, 255, (unsigned int)(*src++));
+    }
+
+    *out_pixels = (unsigned char*)tex_page.PixelsRGBA32;
+    if (out_width) *out_width = TexWidth;
+    if (out_height) *out_height = TexHeight;
+    if (out_bytes_per_pixel) *out_bytes_per_pixel = 4;
+}
+
+void    ImFontAtlas::GetTexPageData(int page, unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel)
+{
+    // Build atlas on demand, then keep 1 byte per-pixel unless color data exists (colored glyphs, or user code writing into TexPixelsRGBA32)
+    if (TexPixelsAlpha8 == NULL && TexPixelsRGBA32 == NULL)
+        Build();
+    if (TexPixelsAlpha8 != NULL && TexPixelsRGBA32 == NULL && !TexPixelsUseColors)
+        GetTexPageDataAsAlpha8(page, out_pixels, out_width, out_height, out_bytes_per_pixel);
+    else
+        GetTexPageDataAsRGBA32(page, out_pixels, out_width, out_height, out_bytes_per_pixel);
+}
+
 ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
@@ -2148,6 +2952,13 @@ ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
     if (new_font_cfg.DstFont->EllipsisChar == (ImWchar)-1)
         new_font_cfg.DstFont->EllipsisChar = font_cfg->EllipsisChar;
 
+    // Merged sources are deferred along with the font they are merged into (see ImFont::LoadDeferredGlyphs())
+    if (new_font_cfg.MergeMode)
+        for (int src_i = 0; src_i < ConfigData.Size - 1; src_i++)
+            if (ConfigData[src_i].DstFont == new_font_cfg.DstFont && !ConfigData[src_i].MergeMode)
+                new_font_cfg.Deferred = ConfigData[src_i].Deferred;
+    IM_ASSERT((!new_font_cfg.Deferred || !new_font_cfg.SDF) && "ImFontConfig::Deferred is not supported with ImFontConfig::SDF.");
+
     // Invalidate texture
     TexReady = false;
     ClearTexData();
@@ -2195,8 +3006,19 @@ ImFont* ImFontAtlas::AddFontDefault(const ImFontConfig* font_cfg_template)
 ImFont* ImFontAtlas::AddFontFromFileTTF(const char* filename, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+
+    // Map the file when requested: rasterizers read directly from the OS file cache instead of a heap copy, and pages are released after Build().
+    // The file stays open so it can be mapped again for a rebuild, regardless of working directory changes or the file being replaced on disk.
     size_t data_size = 0;
-    void* data = ImFileLoadToMemory(filename, "rb", &data_size, 0);
+    void* data = NULL;
+    ImFileMapHandle data_file = (Flags & ImFontAtlasFlags_MapFontFiles) ? ImFileMapOpen(filename) : NULL;
+    if (data_file != NULL && (data = ImFileMapToMemory(data_file, &data_size)) == NULL)
+    {
+        ImFileMapClose(data_file);
+        data_file = NULL;
+    }
+    if (data_file == NULL)
+        data = ImFileLoadToMemory(filename, "rb", &data_size, 0);
     if (!data)
     {
         IM_ASSERT_USER_ERROR(0, "Could not load font file!");
@@ -2210,6 +3032,9 @@ ImFont* ImFontAtlas::AddFontFromFileTTF(const char* filename, float size_pixels,
         for (p = filename + strlen(filename); p > filename && p[-1] != '/' && p[-1] != '\\'; p--) {}
         ImFormatString(font_cfg.Name, IM_ARRAYSIZE(font_cfg.Name), "%s, %.0fpx", p, size_pixels);
     }
+    font_cfg.FontDataFile = data_file;
+    if (data_file != NULL)
+        font_cfg.FontDataOwnedByAtlas = true; // Never copy the mapping
     return AddFontFromMemoryTTF(data, (int)data_size, size_pixels, &font_cfg, glyph_ranges);
 }
 
@@ -2334,7 +3159,366 @@ bool    ImFontAtlas::Build()
     }
 
     // Build
-    return builder_io->FontBuilder_Build(this);
+    ImFontAtlasBuildClearDynamicData(this);
+    if (!ImFontAtlasBuildMapFontData(this))
+        return false;
+    FontBuilderIOUsed = builder_io;
+    const bool ret = builder_io->FontBuilder_Build(this);
+    ImFontAtlasBuildReleaseFontData(this);
+    return ret;
+}
+
+//-----------------------------------------------------------------------------
+// ImFontAtlas cache
+//-----------------------------------------------------------------------------
+// Layout of data produced by SaveCacheToMemory(), in native byte order:
+// - ImFontAtlasCacheHeader
+// - ImFontAtlasCachePage[TexPagesCount - 1]
+// - ImFontAtlasCacheRect[CustomRectsCount]
+// - for each font: ImFontAtlasCacheFont + ImFontGlyph[GlyphsCount] (including glyphs added by ImFontAtlasBuildFinish())
+// - for each texture page: pixels[TexWidth * TexHeight * TexBytesPerPixel]
+//-----------------------------------------------------------------------------
+
+static const ImU32 FONT_ATLAS_CACHE_VERSION = 3;    // Increment when the layout of cached data changes
+
+struct ImFontAtlasCacheHeader
+{
+    char                Magic[4];           // "IMFA"
+    ImU32               Version;            // FONT_ATLAS_CACHE_VERSION
+    ImU32               Key;                // CalcCacheKey()
+    int                 TexWidth, TexHeight;
+    int                 TexBytesPerPixel;   // 1 = TexPixelsAlpha8, 4 = TexPixelsRGBA32
+    int                 TexPixelsUseColors;
+    int                 TexPagesCount;      // 1 + TexExtraPages.Size
+    int                 FontsCount;
+    int                 CustomRectsCount;
+    ImVec2              TexUvWhitePixel;
+    ImVec4              TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];
+    ImVec4              TexUvRoundCorners[IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX * 2 + 1];
+};
+
+struct ImFontAtlasCachePage
+{
+    int                 SDF;                // ImFontAtlasTexPage::SDF
+};
+
+struct ImFontAtlasCacheRect
+{
+    unsigned short      X, Y;
+};
+
+struct ImFontAtlasCacheFont
+{
+    float               FontSize;
+    float               Ascent, Descent;
+    int                 ConfigDataIndex;    // -1 if font wasn't setup by the builder
+    int                 ConfigDataCount;
+    int                 MetricsTotalSurface;
+    int                 GlyphsCount;
+};
+
+struct ImFontAtlasCacheReader
+{
+    const unsigned char* Ptr;
+    const unsigned char* End;
+
+    const void* Read(size_t size) { if ((size_t)(End - Ptr) < size) return NULL; const void* p = Ptr; Ptr += size; return p; }
+};
+
+static void ImFontAtlasCacheWrite(ImVector<unsigned char>* out_data, const void* data, size_t size)
+{
+    const int offset = out_data->Size;
+    out_data->resize(offset + (int)size);
+    memcpy(out_data->Data + offset, data, size);
+}
+
+// Hash of everything affecting the output of Build()
+ImU32 ImFontAtlas::CalcCacheKey()
+{
+    ImFontAtlasBuildInit(this); // Register default custom rectangles, as Build() would
+    if (!ImFontAtlasBuildMapFontData(this))
+    {
+        ImFontAtlasBuildReleaseFontData(this);
+        return 0; // A font file changed: never match a cache, which may have been built from its previous contents
+    }
+
+    // Builder
+    const char* builder_name = "custom";
+#ifdef IMGUI_ENABLE_STB_TRUETYPE
+    if (FontBuilderIO == ImFontAtlasGetBuilderForStbTruetype())
+        builder_name = "stb_truetype";
+#endif
+#ifdef IMGUI_ENABLE_FREETYPE
+    if (FontBuilderIO == NULL || FontBuilderIO == ImGuiFreeType::GetBuilderForFreeType())
+        builder_name = "freetype";
+#elif defined(IMGUI_ENABLE_STB_TRUETYPE)
+    if (FontBuilderIO == NULL)
+        builder_name = "stb_truetype";
+#endif
+    ImU32 key = ImHashStr(builder_name, 0, FONT_ATLAS_CACHE_VERSION);
+    const int layout[] = { (int)sizeof(ImWchar), (int)sizeof(ImFontGlyph), (int)sizeof(ImFontAtlasCacheHeader), (int)sizeof(ImFontAtlasCacheFont), Flags, TexDesiredWidth, TexMaxHeight, TexGlyphPadding, (int)FontBuilderFlags, Fonts.Size };
+    key = ImHashData(layout, sizeof(layout), key);
+
+    // Sources
+    for (int src_i = 0; src_i < ConfigData.Size; src_i++)
+    {
+        const ImFontConfig& cfg = ConfigData[src_i];
+        int dst_index = Fonts.index_from_ptr(Fonts.find(cfg.DstFont));
+        key = ImHashData(cfg.FontData, (size_t)cfg.FontDataSize, key);
+        key = ImHashData(&dst_index, sizeof(dst_index), key);
+        key = ImHashData(&cfg.FontNo, sizeof(cfg.FontNo), key);
+        key = ImHashData(&cfg.SizePixels, sizeof(cfg.SizePixels), key);
+        key = ImHashData(&cfg.OversampleH, sizeof(cfg.OversampleH), key);
+        key = ImHashData(&cfg.OversampleV, sizeof(cfg.OversampleV), key);
+        key = ImHashData(&cfg.PixelSnapH, sizeof(cfg.PixelSnapH), key);
+        key = ImHashData(&cfg.GlyphExtraSpacing, sizeof(cfg.GlyphExtraSpacing), key);
+        key = ImHashData(&cfg.GlyphOffset, sizeof(cfg.GlyphOffset), key);
+        key = ImHashData(&cfg.GlyphMinAdvanceX, sizeof(cfg.GlyphMinAdvanceX), key);
+        key = ImHashData(&cfg.GlyphMaxAdvanceX, sizeof(cfg.GlyphMaxAdvanceX), key);
+        key = ImHashData(&cfg.MergeMode, sizeof(cfg.MergeMode), key);
+        key = ImHashData(&cfg.FontBuilderFlags, sizeof(cfg.FontBuilderFlags), key);
+        key = ImHashData(&cfg.RasterizerMultiply, sizeof(cfg.RasterizerMultiply), key);
+        key = ImHashData(&cfg.EllipsisChar, sizeof(cfg.EllipsisChar), key);
+        key = ImHashData(&cfg.SDF, sizeof(cfg.SDF), key);
+        key = ImHashData(&cfg.SDFPadding, sizeof(cfg.SDFPadding), key);
+        const ImWchar* ranges = cfg.GlyphRanges ? cfg.GlyphRanges : GetGlyphRangesDefault();
+        int ranges_count = 0;
+        while (ranges[ranges_count * 2] && ranges[ranges_count * 2 + 1])
+            ranges_count++;
+        key = ImHashData(ranges, sizeof(ImWchar) * 2 * ranges_count, key);
+    }
+
+    // Custom rectangles
+    for (int rect_i = 0; rect_i < CustomRects.Size; rect_i++)
+    {
+        const ImFontAtlasCustomRect& r = CustomRects[rect_i];
+        int font_index = r.Font ? Fonts.index_from_ptr(Fonts.find(r.Font)) : -1;
+        key = ImHashData(&r.Width, sizeof(r.Width), key);
+        key = ImHashData(&r.Height, sizeof(r.Height), key);
+        key = ImHashData(&r.GlyphID, sizeof(r.GlyphID), key);
+        key = ImHashData(&r.GlyphAdvanceX, sizeof(r.GlyphAdvanceX), key);
+        key = ImHashData(&r.GlyphOffset, sizeof(r.GlyphOffset), key);
+        key = ImHashData(&font_index, sizeof(font_index), key);
+    }
+
+    // Don't keep font files mapped when called after Build() (e.g. SaveCacheToMemory())
+    if (TexReady)
+        ImFontAtlasBuildReleaseFontData(this);
+    return (key != 0) ? key : 1;
+}
+
+bool ImFontAtlas::SaveCacheToMemory(ImVector<unsigned char>* out_data)
+{
+    IM_ASSERT(IsBuilt() && "Atlas needs to be built before saving it.");
+    IM_ASSERT((Flags & ImFontAtlasFlags_DynamicGlyphs) == 0 && "ImFontAtlasFlags_DynamicGlyphs is not supported by the atlas cache.");
+    if (!IsBuilt() || (Flags & ImFontAtlasFlags_DynamicGlyphs) || (TexPixelsAlpha8 == NULL && TexPixelsRGBA32 == NULL))
+        return false;
+
+    const ImU32 key = CalcCacheKey();
+    if (key == 0)
+        return false;
+
+    ImFontAtlasCacheHeader header;
+    memcpy(header.Magic, "IMFA", 4);
+    header.Version = FONT_ATLAS_CACHE_VERSION;
+    header.Key = key;
+    header.TexWidth = TexWidth;
+    header.TexHeight = TexHeight;
+    header.TexBytesPerPixel = TexPixelsAlpha8 ? 1 : 4;
+    header.TexPixelsUseColors = TexPixelsUseColors ? 1 : 0;
+    header.TexPagesCount = GetTexPageCount();
+    header.FontsCount = Fonts.Size;
+    header.CustomRectsCount = CustomRects.Size;
+    header.TexUvWhitePixel = TexUvWhitePixel;
+    memcpy(header.TexUvLines, TexUvLines, sizeof(TexUvLines));
+    memcpy(header.TexUvRoundCorners, TexUvRoundCorners, sizeof(TexUvRoundCorners));
+    out_data->resize(0);
+    ImFontAtlasCacheWrite(out_data, &header, sizeof(header));
+
+    for (int page_i = 0; page_i < TexExtraPages.Size; page_i++)
+    {
+        ImFontAtlasCachePage page = { TexExtraPages[page_i].SDF ? 1 : 0 };
+        ImFontAtlasCacheWrite(out_data, &page, sizeof(page));
+    }
+
+    for (int rect_i = 0; rect_i < CustomRects.Size; rect_i++)
+    {
+        ImFontAtlasCacheRect r = { CustomRects[rect_i].X, CustomRects[rect_i].Y };
+        ImFontAtlasCacheWrite(out_data, &r, sizeof(r));
+    }
+
+    for (int font_i = 0; font_i < Fonts.Size; font_i++)
+    {
+        ImFont* font = Fonts[font_i];
+        ImFontAtlasCacheFont font_data;
+        font_data.FontSize = font->FontSize;
+        font_data.Ascent = font->Ascent;
+        font_data.Descent = font->Descent;
+        font_data.ConfigDataIndex = (font->ConfigData != NULL) ? (int)(font->ConfigData - ConfigData.Data) : -1;
+        font_data.ConfigDataCount = font->ConfigDataCount;
+        font_data.MetricsTotalSurface = font->MetricsTotalSurface;
+        font_data.GlyphsCount = font->Glyphs.Size;
+        ImFontAtlasCacheWrite(out_data, &font_data, sizeof(font_data));
+        ImFontAtlasCacheWrite(out_data, font->Glyphs.Data, sizeof(ImFontGlyph) * font_data.GlyphsCount);
+    }
+
+    for (int page_n = 0; page_n < header.TexPagesCount; page_n++)
+    {
+        const void* pixels = (page_n == 0) ? (TexPixelsAlpha8 ? (const void*)TexPixelsAlpha8 : (const void*)TexPixelsRGBA32) : (TexPixelsAlpha8 ? (const void*)TexExtraPages[page_n - 1].PixelsAlpha8 : (const void*)TexExtraPages[page_n - 1].PixelsRGBA32);
+        ImFontAtlasCacheWrite(out_data, pixels, (size_t)TexWidth * TexHeight * header.TexBytesPerPixel);
+    }
+    return true;
+}
+
+bool ImFontAtlas::LoadCacheFromMemory(const void* data, size_t data_size)
+{
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    IM_ASSERT((Flags & ImFontAtlasFlags_DynamicGlyphs) == 0 && "ImFontAtlasFlags_DynamicGlyphs is not supported by the atlas cache.");
+    if (ConfigData.Size == 0 || (Flags & ImFontAtlasFlags_DynamicGlyphs))
+        return false;
+
+    // Validate everything before modifying the atlas
+    ImFontAtlasCacheReader reader = { (const unsigned char*)data, (const unsigned char*)data + data_size };
+    const ImFontAtlasCacheHeader* header = (const ImFontAtlasCacheHeader*)reader.Read(sizeof(ImFontAtlasCacheHeader));
+    if (header == NULL || memcmp(header->Magic, "IMFA", 4) != 0 || header->Version != FONT_ATLAS_CACHE_VERSION || header->Key == 0 || header->Key != CalcCacheKey())
+        return false;
+    if (header->FontsCount != Fonts.Size || header->CustomRectsCount != CustomRects.Size || header->TexPagesCount < 1 || header->TexPagesCount > 256 || (header->TexBytesPerPixel != 1 && header->TexBytesPerPixel != 4))
+        return false;
+    if (header->TexWidth <= 0 || header->TexHeight <= 0 || header->TexWidth > 0x10000 || header->TexHeight > 0x10000) // Custom rectangles positions are stored as unsigned short
+        return false;
+    const ImFontAtlasCachePage* pages = (const ImFontAtlasCachePage*)reader.Read(sizeof(ImFontAtlasCachePage) * (header->TexPagesCount - 1));
+    const ImFontAtlasCacheRect* rects = (const ImFontAtlasCacheRect*)reader.Read(sizeof(ImFontAtlasCacheRect) * header->CustomRectsCount);
+    if (pages == NULL || rects == NULL)
+        return false;
+    ImVector<const ImFontAtlasCacheFont*> fonts_data;
+    fonts_data.resize(header->FontsCount);
+    for (int font_i = 0; font_i < header->FontsCount; font_i++)
+    {
+        const ImFontAtlasCacheFont* font_data = (const ImFontAtlasCacheFont*)reader.Read(sizeof(ImFontAtlasCacheFont));
+        if (font_data == NULL || font_data->GlyphsCount < 0 || (size_t)font_data->GlyphsCount > (size_t)(reader.End - reader.Ptr) / sizeof(ImFontGlyph))
+            return false;
+        if (font_data->ConfigDataIndex < -1 || font_data->ConfigDataIndex >= ConfigData.Size || font_data->ConfigDataCount < 0 || font_data->ConfigDataCount > ConfigData.Size - ImMax(font_data->ConfigDataIndex, 0))
+            return false;
+        const ImFontGlyph* glyphs = (const ImFontGlyph*)reader.Read(sizeof(ImFontGlyph) * font_data->GlyphsCount);
+        for (int glyph_i = 0; glyph_i < font_data->GlyphsCount; glyph_i++)
+            if (glyphs[glyph_i].Codepoint > IM_UNICODE_CODEPOINT_MAX || (int)glyphs[glyph_i].TexPage >= header->TexPagesCount)
+                return false;
+        fonts_data[font_i] = font_data;
+    }
+
+    // Check pixels size against remaining data before multiplying, so crafted sizes can't overflow size_t (TexWidth * TexHeight * 4 * 256 doesn't fit in 32-bit)
+    const size_t tex_row_size = (size_t)header->TexWidth * header->TexBytesPerPixel;
+    if ((size_t)header->TexHeight > (size_t)(reader.End - reader.Ptr) / tex_row_size / (size_t)header->TexPagesCount)
+        return false;
+    const size_t tex_size = tex_row_size * header->TexHeight;
+    const unsigned char* pixels = (const unsigned char*)reader.Read(tex_size * header->TexPagesCount);
+    if (pixels == NULL)
+        return false;
+
+    // Restore texture (same as what builders do before rasterizing)
+    ImFontAtlasBuildClearDynamicData(this);
+    TexID = (ImTextureID)NULL;
+    ClearTexData();
+    TexWidth = header->TexWidth;
+    TexHeight = header->TexHeight;
+    TexUvScale = ImVec2(1.0f / TexWidth, 1.0f / TexHeight);
+    TexUvWhitePixel = header->TexUvWhitePixel;
+    memcpy(TexUvLines, header->TexUvLines, sizeof(TexUvLines));
+    memcpy(TexUvRoundCorners, header->TexUvRoundCorners, sizeof(TexUvRoundCorners));
+    TexPixelsUseColors = header->TexPixelsUseColors != 0;
+    if (header->TexBytesPerPixel == 1)
+    {
+        TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(tex_size);
+        memcpy(TexPixelsAlpha8, pixels, tex_size);
+    }
+    else
+    {
+        TexPixelsRGBA32 = (unsigned int*)IM_ALLOC(tex_size);
+        memcpy(TexPixelsRGBA32, pixels, tex_size);
+    }
+    TexExtraPages.resize(header->TexPagesCount - 1);
+    if (TexExtraPages.Size > 0)
+        memset(TexExtraPages.Data, 0, (size_t)TexExtraPages.size_in_bytes());
+    for (int page_i = 0; page_i < TexExtraPages.Size; page_i++)
+        TexExtraPages[page_i].SDF = pages[page_i].SDF != 0;
+    ImFontAtlasBuildAllocExtraPages(this);
+    for (int page_n = 1; page_n < header->TexPagesCount; page_n++)
+    {
+        ImFontAtlasTexPage& page = TexExtraPages[page_n - 1];
+        memcpy(page.PixelsAlpha8 ? (void*)page.PixelsAlpha8 : (void*)page.PixelsRGBA32, pixels + tex_size * page_n, tex_size);
+    }
+    for (int rect_i = 0; rect_i < CustomRects.Size; rect_i++)
+    {
+        CustomRects[rect_i].X = rects[rect_i].X;
+        CustomRects[rect_i].Y = rects[rect_i].Y;
+    }
+
+    // Restore fonts (same as what ImFontAtlasBuildSetupFont() and builders do)
+    for (int font_i = 0; font_i < Fonts.Size; font_i++)
+    {
+        ImFont* font = Fonts[font_i];
+        const ImFontAtlasCacheFont* font_data = fonts_data[font_i];
+        font->ClearOutputData();
+        if (font_data->ConfigDataIndex >= 0)
+        {
+            font->FontSize = font_data->FontSize;
+            font->ConfigData = &ConfigData[font_data->ConfigDataIndex];
+            font->ConfigDataCount = (short)font_data->ConfigDataCount;
+            font->ContainerAtlas = this;
+            font->Ascent = font_data->Ascent;
+            font->Descent = font_data->Descent;
+        }
+        font->Glyphs.resize(font_data->GlyphsCount);
+        if (font_data->GlyphsCount > 0)
+            memcpy(font->Glyphs.Data, font_data + 1, sizeof(ImFontGlyph) * font_data->GlyphsCount);
+    }
+
+    // Pixels already contain default data and glyphs already include custom rectangles: only build lookup tables (see ImFontAtlasBuildFinish())
+    for (int font_i = 0; font_i < Fonts.Size; font_i++)
+    {
+        Fonts[font_i]->BuildLookupTable();
+        Fonts[font_i]->MetricsTotalSurface = fonts_data[font_i]->MetricsTotalSurface;
+    }
+    TexReady = true;
+    ImFontAtlasBuildReleaseFontData(this);
+    return true;
+}
+
+bool ImFontAtlas::LoadCacheFromDisk(const char* filename)
+{
+    size_t file_data_size = 0;
+    void* file_data = ImFileLoadToMemory(filename, "rb", &file_data_size);
+    if (file_data == NULL)
+        return false;
+    bool ret = LoadCacheFromMemory(file_data, file_data_size);
+    IM_FREE(file_data);
+    return ret;
+}
+
+bool ImFontAtlas::SaveCacheToDisk(const char* filename)
+{
+    ImVector<unsigned char> data;
+    if (!SaveCacheToMemory(&data))
+        return false;
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (f == NULL)
+        return false;
+    bool ret = ImFileWrite(data.Data, 1, (ImU64)data.Size, f) == (ImU64)data.Size;
+    ImFileClose(f);
+    return ret;
+}
+
+bool ImFontAtlas::BuildWithCache(const char* filename)
+{
+    // Default font if none are specified
+    if (ConfigData.Size == 0)
+        AddFontDefault();
+    if (LoadCacheFromDisk(filename))
+        return true;
+    if (!Build())
+        return false;
+    SaveCacheToDisk(filename);
+    return true;
 }
 
 void    ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_brighten_factor)
@@ -2381,6 +3565,152 @@ struct ImFontBuildDstData
     ImBitVector         GlyphsSet;          // This is used to resolve collision when multiple sources are merged into a same destination font.
 };
 
+// A slice of glyphs from one source font, processed by one call to a job function (see ImFontAtlasBuildParallelFor())
+struct ImFontBuildJob
+{
+    int                 SrcIndex;
+    int                 GlyphsStart;
+    int                 GlyphsCount;
+};
+
+// Data shared by all jobs of a build step
+struct ImFontBuildJobsData
+{
+    ImFontAtlas*                Atlas;
+    ImFontBuildSrcData*         SrcTmpArray;
+    ImVector<ImFontBuildJob>    Jobs;
+    unsigned int                CodepointMax;       // Step 2: highest codepoint to look up
+    const stbtt_pack_context*   PackContext;        // Step 8: texture to render into
+};
+
+// Glyphs are split into jobs of this size so one large source font (e.g. CJK) doesn't end up on a single thread.
+static const int FONT_BUILD_JOB_GLYPHS_COUNT = 256;
+
+// Build step 2 job, for source font 'job_index': look up which requested codepoints are available in the font data.
+static void ImFontAtlasBuildJobFindGlyphs(void* job_data, int job_index)
+{
+    ImFontBuildJobsData* data = (ImFontBuildJobsData*)job_data;
+    ImFontBuildSrcData& src_tmp = data->SrcTmpArray[job_index];
+    if (data->Atlas->ConfigData[job_index].Deferred && (data->Atlas->Flags & ImFontAtlasFlags_DynamicGlyphs))
+        return; // Rasterized on first use by ImFont::LoadDeferredGlyphs()
+    for (const ImWchar* src_range = src_tmp.SrcRanges; src_range[0] && src_range[1]; src_range += 2)
+        for (unsigned int codepoint = src_range[0]; codepoint <= src_range[1] && codepoint <= data->CodepointMax; codepoint++)
+            if (stbtt_FindGlyphIndex(&src_tmp.FontInfo, codepoint))
+                src_tmp.GlyphsSet.SetBit(codepoint);
+}
+
+// Build step 4 job: gather the sizes of all rectangles we will need to pack (this loop is based on stbtt_PackFontRangesGatherRects)
+static void ImFontAtlasBuildJobGatherRects(void* job_data, int job_index)
+{
+    ImFontBuildJobsData* data = (ImFontBuildJobsData*)job_data;
+    const ImFontBuildJob& job = data->Jobs[job_index];
+    ImFontBuildSrcData& src_tmp = data->SrcTmpArray[job.SrcIndex];
+    const ImFontConfig& cfg = data->Atlas->ConfigData[job.SrcIndex];
+    const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
+    const int padding = data->Atlas->TexGlyphPadding;
+    for (int glyph_i = job.GlyphsStart; glyph_i < job.GlyphsStart + job.GlyphsCount; glyph_i++)
+    {
+        int x0, y0, x1, y1;
+        const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
+        IM_ASSERT(glyph_index_in_font != 0);
+        if (cfg.SDF)
+        {
+            // Same box as stbtt_GetGlyphSDF(), which returns no bitmap for empty glyphs
+            stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale, scale, 0, 0, &x0, &y0, &x1, &y1);
+            const bool is_empty = (x0 == x1 || y0 == y1);
+            src_tmp.Rects[glyph_i].w = is_empty ? 0 : (stbrp_coord)(x1 - x0 + cfg.SDFPadding * 2 + padding);
+            src_tmp.Rects[glyph_i].h = is_empty ? 0 : (stbrp_coord)(y1 - y0 + cfg.SDFPadding * 2 + padding);
+            src_tmp.Rects[glyph_i].id = 1; // Pack into SDF pages, see ImFontAtlasBuildPackExtraPages()
+            continue;
+        }
+        stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
+        src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
+        src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
+    }
+}
+
+// Build step 8 for ImFontConfig::SDF sources: render signed distance fields and fill stbtt_packedchar the way stbtt_PackFontRangesRenderIntoRects() would.
+// Distance is encoded with 0.5 (128) on glyph edges, increasing inside the glyph, and reaches 0 at SDFPadding pixels outside of the glyph.
+static void ImFontAtlasBuildRenderGlyphsSDF(ImFontAtlas* atlas, ImFontBuildSrcData& src_tmp, const ImFontConfig& cfg, int glyphs_start, int glyphs_count)
+{
+    const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
+    const int padding = atlas->TexGlyphPadding;
+    for (int glyph_i = glyphs_start; glyph_i < glyphs_start + glyphs_count; glyph_i++)
+    {
+        const stbrp_rect& r = src_tmp.Rects[glyph_i];
+        stbtt_packedchar& pc = src_tmp.PackedChars[glyph_i];
+        const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
+        int advance, lsb;
+        stbtt_GetGlyphHMetrics(&src_tmp.FontInfo, glyph_index_in_font, &advance, &lsb);
+        pc.xadvance = scale * advance;
+        if (!r.was_packed || r.w == 0 || r.h == 0)
+            continue;
+
+        int w, h, xoff, yoff;
+        unsigned char* sdf = stbtt_GetGlyphSDF(&src_tmp.FontInfo, scale, glyph_index_in_font, cfg.SDFPadding, 128, 128.0f / cfg.SDFPadding, &w, &h, &xoff, &yoff);
+        if (sdf == NULL)
+            continue;
+        IM_ASSERT(w + padding <= r.w && h + padding <= r.h);
+        const int x = r.x + padding;
+        const int y = r.y + padding;
+        unsigned char* pixels = atlas->TexExtraPages[r.id - 1].PixelsAlpha8;
+        for (int row = 0; row < h; row++)
+            memcpy(pixels + (y + row) * atlas->TexWidth + x, sdf + row * w, (size_t)w);
+        stbtt_FreeSDF(sdf, src_tmp.FontInfo.userdata);
+        pc.x0 = (unsigned short)x;
+        pc.y0 = (unsigned short)y;
+        pc.x1 = (unsigned short)(x + w);
+        pc.y1 = (unsigned short)(y + h);
+        pc.xoff = (float)xoff;
+        pc.yoff = (float)yoff;
+        pc.xoff2 = (float)(xoff + w);
+        pc.yoff2 = (float)(yoff + h);
+    }
+}
+
+// Build step 8 job: render/rasterize font characters into their packed rectangles. Rectangles don't overlap so jobs can write to the texture concurrently.
+// Consecutive glyphs on a same texture page (stbrp_rect::id, see ImFontAtlasBuildPackExtraPages()) are rendered together.
+static void ImFontAtlasBuildJobRenderGlyphs(void* job_data, int job_index)
+{
+    ImFontBuildJobsData* data = (ImFontBuildJobsData*)job_data;
+    const ImFontBuildJob& job = data->Jobs[job_index];
+    ImFontBuildSrcData& src_tmp = data->SrcTmpArray[job.SrcIndex];
+    const ImFontConfig& cfg = data->Atlas->ConfigData[job.SrcIndex];
+    if (cfg.SDF)
+    {
+        ImFontAtlasBuildRenderGlyphsSDF(data->Atlas, src_tmp, cfg, job.GlyphsStart, job.GlyphsCount);
+        return;
+    }
+    unsigned char multiply_table[256];
+    if (cfg.RasterizerMultiply != 1.0f)
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+
+    for (int run_start = job.GlyphsStart, run_end = run_start; run_start < job.GlyphsStart + job.GlyphsCount; run_start = run_end)
+    {
+        const int page = src_tmp.Rects[run_start].id;
+        while (run_end < job.GlyphsStart + job.GlyphsCount && src_tmp.Rects[run_end].id == page)
+            run_end++;
+        unsigned char* pixels = (page == 0) ? data->Atlas->TexPixelsAlpha8 : data->Atlas->TexExtraPages[page - 1].PixelsAlpha8;
+
+        stbtt_pack_context spc = *data->PackContext; // Copy as stbtt_PackFontRangesRenderIntoRects() temporarily modifies it
+        spc.pixels = pixels;
+        stbtt_pack_range pack_range = src_tmp.PackRange;
+        pack_range.array_of_unicode_codepoints = src_tmp.GlyphsList.Data + run_start;
+        pack_range.num_chars = run_end - run_start;
+        pack_range.chardata_for_range = src_tmp.PackedChars + run_start;
+        stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &pack_range, 1, src_tmp.Rects + run_start);
+
+        // Apply multiply operator
+        if (cfg.RasterizerMultiply != 1.0f)
+            for (int glyph_i = run_start; glyph_i < run_end; glyph_i++)
+            {
+                const stbrp_rect* r = &src_tmp.Rects[glyph_i];
+                if (r->was_packed)
+                    ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, pixels, r->x, r->y, r->w, r->h, data->Atlas->TexWidth * 1);
+            }
+    }
+}
+
 static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>* out)
 {
     IM_ASSERT(sizeof(in->Storage.Data[0]) == sizeof(int));
@@ -2405,6 +3735,7 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     atlas->TexUvScale = ImVec2(0.0f, 0.0f);
     atlas->TexUvWhitePixel = ImVec2(0.0f, 0.0f);
     atlas->ClearTexData();
+    atlas->TexExtraPages.clear();
 
     // Temporary storage for building
     ImVector<ImFontBuildSrcData> src_tmp_array;
@@ -2431,6 +3762,8 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
             IM_ASSERT(src_tmp.DstIndex != -1); // cfg.DstFont not pointing within atlas->Fonts[] array?
             return false;
         }
+        IM_ASSERT((!cfg.SDF || (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs) == 0) && "ImFontConfig::SDF is not supported with ImFontAtlasFlags_DynamicGlyphs.");
+
         // Initialize helper structure for font loading and verify that the TTF/OTF data is correct
         const int font_offset = stbtt_GetFontOffsetForIndex((unsigned char*)cfg.FontData, cfg.FontNo);
         IM_ASSERT(font_offset >= 0 && "FontData is incorrect, or FontNo cannot be found.");
@@ -2452,7 +3785,13 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     }
 
     // 2. For every requested codepoint, check for their presence in the font data, and handle redundancy or overlaps between source fonts to avoid unused glyphs.
-    int total_glyphs_count = 0;
+    // (With ImFontAtlasFlags_DynamicGlyphs, codepoints above IM_FONTATLAS_DYNAMIC_GLYPHS_PRELOAD_MAX are rasterized on demand by ImFontAtlasBuildGlyphWithStbTruetype())
+    // Lookups run as one job per source font, then sources are merged in order so the result doesn't depend on job scheduling.
+    ImFontBuildJobsData jobs_data;
+    jobs_data.Atlas = atlas;
+    jobs_data.SrcTmpArray = src_tmp_array.Data;
+    jobs_data.CodepointMax = (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs) ? IM_FONTATLAS_DYNAMIC_GLYPHS_PRELOAD_MAX : IM_UNICODE_CODEPOINT_MAX;
+    jobs_data.PackContext = NULL;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
@@ -2460,22 +3799,27 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         src_tmp.GlyphsSet.Create(src_tmp.GlyphsHighest + 1);
         if (dst_tmp.GlyphsSet.Storage.empty())
             dst_tmp.GlyphsSet.Create(dst_tmp.GlyphsHighest + 1);
+    }
+    ImFontAtlasBuildParallelFor(atlas, ImFontAtlasBuildJobFindGlyphs, &jobs_data, src_tmp_array.Size);
 
-        for (const ImWchar* src_range = src_tmp.SrcRanges; src_range[0] && src_range[1]; src_range += 2)
-            for (unsigned int codepoint = src_range[0]; codepoint <= src_range[1]; codepoint++)
-            {
-                if (dst_tmp.GlyphsSet.TestBit(codepoint))    // Don't overwrite existing glyphs. We could make this an option for MergeMode (e.g. MergeOverwrite==true)
-                    continue;
-                if (!stbtt_FindGlyphIndex(&src_tmp.FontInfo, codepoint))    // It is actually in the font?
-                    continue;
-
-                // Add to avail set/counters
+    int total_glyphs_count = 0;
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+    {
+        // Don't overwrite existing glyphs. We could make this an option for MergeMode (e.g. MergeOverwrite==true)
+        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
+        ImFontBuildDstData& dst_tmp = dst_tmp_array[src_tmp.DstIndex];
+        ImU32* src_bits = src_tmp.GlyphsSet.Storage.Data;
+        ImU32* dst_bits = dst_tmp.GlyphsSet.Storage.Data;
+        for (int n = 0; n < src_tmp.GlyphsSet.Storage.Size; n++)
+        {
+            ImU32 bits = src_bits[n] & ~dst_bits[n];
+            src_bits[n] = bits;
+            dst_bits[n] |= bits;
+            for (; bits != 0; bits &= bits - 1)
                 src_tmp.GlyphsCount++;
-                dst_tmp.GlyphsCount++;
-                src_tmp.GlyphsSet.SetBit(codepoint);
-                dst_tmp.GlyphsSet.SetBit(codepoint);
-                total_glyphs_count++;
-            }
+        }
+        dst_tmp.GlyphsCount += src_tmp.GlyphsCount;
+        total_glyphs_count += src_tmp.GlyphsCount;
     }
 
     // 3. Unpack our bit map into a flat list (we now have all the Unicode points that we know are requested _and_ available _and_ not overlapping another)
@@ -2492,16 +3836,18 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     dst_tmp_array.clear();
 
     // Allocate packing character data and flag packed characters buffer as non-packed (x0=y0=x1=y1=0)
-    // (We technically don't need to zero-clear buf_rects, but let's do it for the sake of sanity)
+    // (Zero-clear buf_rects: stbrp_rect::id stores the texture page, see ImFontAtlasBuildPackExtraPages())
     ImVector<stbrp_rect> buf_rects;
     ImVector<stbtt_packedchar> buf_packedchars;
     buf_rects.resize(total_glyphs_count);
     buf_packedchars.resize(total_glyphs_count);
-    memset(buf_rects.Data, 0, (size_t)buf_rects.size_in_bytes());
-    memset(buf_packedchars.Data, 0, (size_t)buf_packedchars.size_in_bytes());
+    if (total_glyphs_count > 0) // May be zero when all fonts are ImFontConfig::Deferred
+    {
+        memset(buf_rects.Data, 0, (size_t)buf_rects.size_in_bytes());
+        memset(buf_packedchars.Data, 0, (size_t)buf_packedchars.size_in_bytes());
+    }
 
     // 4. Gather glyphs sizes so we can pack them in our virtual canvas.
-    int total_surface = 0;
     int buf_rects_out_n = 0;
     int buf_packedchars_out_n = 0;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
@@ -2525,20 +3871,17 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         src_tmp.PackRange.h_oversample = (unsigned char)cfg.OversampleH;
         src_tmp.PackRange.v_oversample = (unsigned char)cfg.OversampleV;
 
-        // Gather the sizes of all rectangles we will need to pack (this loop is based on stbtt_PackFontRangesGatherRects)
-        const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
-        const int padding = atlas->TexGlyphPadding;
-        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsList.Size; glyph_i++)
+        // Split glyphs into jobs, reused for rendering in step 8
+        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i += FONT_BUILD_JOB_GLYPHS_COUNT)
         {
-            int x0, y0, x1, y1;
-            const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
-            IM_ASSERT(glyph_index_in_font != 0);
-            stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
-            src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
-            src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
-            total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
+            ImFontBuildJob job = { src_i, glyph_i, ImMin(FONT_BUILD_JOB_GLYPHS_COUNT, src_tmp.GlyphsCount - glyph_i) };
+            jobs_data.Jobs.push_back(job);
         }
     }
+    ImFontAtlasBuildParallelFor(atlas, ImFontAtlasBuildJobGatherRects, &jobs_data, jobs_data.Jobs.Size);
+    int total_surface = 0;
+    for (int rect_i = 0; rect_i < buf_rects.Size; rect_i++)
+        total_surface += buf_rects[rect_i].w * buf_rects[rect_i].h;
 
     // We need a width for the skyline algorithm, any width!
     // The exact width doesn't really matter much, but some API/GPU have texture size limitations and increasing width can decrease height.
@@ -2548,65 +3891,59 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     if (atlas->TexDesiredWidth > 0)
         atlas->TexWidth = atlas->TexDesiredWidth;
     else
-        atlas->TexWidth = (surface_sqrt >= 4096 * 0.7f) ? 4096 : (surface_sqrt >= 2048 * 0.7f) ? 2048 : (surface_sqrt >= 1024 * 0.7f) ? 1024 : 512;
+        atlas->TexWidth = (surface_sqrt >= 4096 * 0.7f) ? 4096 : (surface_sqrt >= 2048 * 0.7f) ? 2048 : (surface_sqrt >= 1024 * 0.7f || (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs)) ? 1024 : 512;
 
     // 5. Start packing
     // Pack our extra data rectangles first, so it will be on the upper-left corner of our texture (UV will have small values).
     const int TEX_HEIGHT_MAX = 1024 * 32;
     stbtt_pack_context spc = {};
-    stbtt_PackBegin(&spc, NULL, atlas->TexWidth, TEX_HEIGHT_MAX, 0, atlas->TexGlyphPadding, NULL);
-    ImFontAtlasBuildPackCustomRects(atlas, spc.pack_info);
+    stbtt_PackBegin(&spc, NULL, atlas->TexWidth, (atlas->TexMaxHeight > 0) ? atlas->TexMaxHeight : TEX_HEIGHT_MAX, 0, atlas->TexGlyphPadding, NULL);
+    ImFontAtlasRectPacker* packer = ImFontAtlasBuildPackBegin(atlas, atlas->TexWidth - atlas->TexGlyphPadding, ((atlas->TexMaxHeight > 0) ? atlas->TexMaxHeight : TEX_HEIGHT_MAX) - atlas->TexGlyphPadding);
+    ImFontAtlasBuildPackCustomRects(atlas, packer);
 
     // 6. Pack each source font. No rendering yet, we are working with rectangles in an infinitely tall texture at this point.
+    // (ImFontConfig::SDF sources are packed in their own pages by ImFontAtlasBuildPackExtraPages())
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
+        if (src_tmp.GlyphsCount == 0 || atlas->ConfigData[src_i].SDF)
             continue;
 
-        stbrp_pack_rects((stbrp_context*)spc.pack_info, src_tmp.Rects, src_tmp.GlyphsCount);
+        // With ImFontAtlasFlags_PackShelves, pack following sources in the same call (their rectangles are contiguous in buf_rects):
+        // the shelf packer wastes less space when it sees rectangles of all heights at once.
+        int rects_count = src_tmp.GlyphsCount;
+        while ((atlas->Flags & ImFontAtlasFlags_PackShelves) && src_i + 1 < src_tmp_array.Size && !atlas->ConfigData[src_i + 1].SDF)
+            rects_count += src_tmp_array[++src_i].GlyphsCount;
+        ImFontAtlasBuildPackRects(packer, src_tmp.Rects, rects_count);
 
         // Extend texture height and mark missing glyphs as non-packed so we won't render them.
         // FIXME: We are not handling packing failure here (would happen if we got off TEX_HEIGHT_MAX or if a single if larger than TexWidth?)
-        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++)
+        for (int glyph_i = 0; glyph_i < rects_count; glyph_i++)
             if (src_tmp.Rects[glyph_i].was_packed)
                 atlas->TexHeight = ImMax(atlas->TexHeight, src_tmp.Rects[glyph_i].y + src_tmp.Rects[glyph_i].h);
     }
+    ImFontAtlasBuildPackEnd(packer);
+    const int tex_pages_count = ImFontAtlasBuildPackExtraPages(atlas, buf_rects.Data, buf_rects.Size);
 
     // 7. Allocate texture
+    if (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs)
+        ImFontAtlasBuildReserveDynamicSpace(atlas);
     atlas->TexHeight = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (atlas->TexHeight + 1) : ImUpperPowerOfTwo(atlas->TexHeight);
+    if (atlas->TexMaxHeight > 0)
+        atlas->TexHeight = (tex_pages_count > 1) ? atlas->TexMaxHeight : ImMin(atlas->TexHeight, atlas->TexMaxHeight); // All pages have the same size
     atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
     atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(atlas->TexWidth * atlas->TexHeight);
     memset(atlas->TexPixelsAlpha8, 0, atlas->TexWidth * atlas->TexHeight);
+    ImFontAtlasBuildAllocExtraPages(atlas);
     spc.pixels = atlas->TexPixelsAlpha8;
     spc.height = atlas->TexHeight;
 
     // 8. Render/rasterize font characters into the texture
-    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
-    {
-        ImFontConfig& cfg = atlas->ConfigData[src_i];
-        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
-            continue;
-
-        stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
-
-        // Apply multiply operator
-        if (cfg.RasterizerMultiply != 1.0f)
-        {
-            unsigned char multiply_table[256];
-            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
-            stbrp_rect* r = &src_tmp.Rects[0];
-            for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++, r++)
-                if (r->was_packed)
-                    ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
-        }
-        src_tmp.Rects = NULL;
-    }
+    jobs_data.PackContext = &spc;
+    ImFontAtlasBuildParallelFor(atlas, ImFontAtlasBuildJobRenderGlyphs, &jobs_data, jobs_data.Jobs.Size);
 
     // End packing
     stbtt_PackEnd(&spc);
-    buf_rects.clear();
 
     // 9. Setup ImFont and glyphs for runtime
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
@@ -2637,7 +3974,20 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
             float unused_x = 0.0f, unused_y = 0.0f;
             stbtt_GetPackedQuad(src_tmp.PackedChars, atlas->TexWidth, atlas->TexHeight, glyph_i, &unused_x, &unused_y, &q, 0);
             dst_font->AddGlyph(&cfg, (ImWchar)codepoint, q.x0 + font_off_x, q.y0 + font_off_y, q.x1 + font_off_x, q.y1 + font_off_y, q.s0, q.t0, q.s1, q.t1, pc.xadvance);
+            dst_font->Glyphs.back().TexPage = src_tmp.Rects[glyph_i].was_packed ? (unsigned int)src_tmp.Rects[glyph_i].id : 0;
         }
+        src_tmp.Rects = NULL;
+    }
+    buf_rects.clear();
+
+    // Keep font info around to rasterize remaining glyphs on demand
+    if (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs)
+    {
+        ImVector<stbtt_fontinfo>* font_infos = IM_NEW(ImVector<stbtt_fontinfo>)();
+        font_infos->resize(src_tmp_array.Size);
+        for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+            (*font_infos)[src_i] = src_tmp_array[src_i].FontInfo;
+        atlas->FontBuilderData = font_infos;
     }
 
     // Cleanup
@@ -2647,10 +3997,80 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     return true;
 }
 
+// Rasterize a single glyph into the free space reserved by ImFontAtlasBuildWithStbTruetype() (ImFontAtlasFlags_DynamicGlyphs)
+// This follows the same steps as the full build for one codepoint, so output matches what a full build would have produced.
+static bool ImFontAtlasBuildGlyphWithStbTruetype(ImFontAtlas* atlas, ImFontConfig* src_cfg, ImWchar codepoint)
+{
+    ImVector<stbtt_fontinfo>* font_infos = (ImVector<stbtt_fontinfo>*)atlas->FontBuilderData;
+    const int src_i = (int)(src_cfg - atlas->ConfigData.Data);
+    IM_ASSERT(src_i >= 0 && src_i < font_infos->Size && atlas->TexPixelsAlpha8 != NULL);
+    const stbtt_fontinfo* font_info = &(*font_infos)[src_i];
+    const int glyph_index_in_font = stbtt_FindGlyphIndex(font_info, codepoint);
+    if (glyph_index_in_font == 0)
+        return false;
+
+    // Gather size and pack
+    const ImFontConfig& cfg = *src_cfg;
+    const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(font_info, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(font_info, -cfg.SizePixels);
+    const int padding = atlas->TexGlyphPadding;
+    int x0, y0, x1, y1;
+    stbtt_GetGlyphBitmapBoxSubpixel(font_info, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
+    stbrp_rect rect = {};
+    rect.w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
+    rect.h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
+    int rect_x, rect_y;
+    if (!ImFontAtlasBuildAllocDynamicRect(atlas, rect.w, rect.h, &rect_x, &rect_y))
+        return false;
+    rect.x = (stbrp_coord)rect_x;
+    rect.y = (stbrp_coord)rect_y;
+    rect.was_packed = 1;
+
+    // Render/rasterize into the texture
+    int codepoint_i = (int)codepoint;
+    stbtt_packedchar packed_char = {};
+    stbtt_pack_range pack_range = {};
+    pack_range.font_size = cfg.SizePixels;
+    pack_range.array_of_unicode_codepoints = &codepoint_i;
+    pack_range.num_chars = 1;
+    pack_range.chardata_for_range = &packed_char;
+    pack_range.h_oversample = (unsigned char)cfg.OversampleH;
+    pack_range.v_oversample = (unsigned char)cfg.OversampleV;
+    stbtt_pack_context spc = {};
+    spc.width = atlas->TexWidth;
+    spc.height = atlas->TexHeight;
+    spc.stride_in_bytes = atlas->TexWidth;
+    spc.padding = padding;
+    spc.pixels = atlas->TexPixelsAlpha8;
+    stbtt_PackFontRangesRenderIntoRects(&spc, font_info, &pack_range, 1, &rect);
+    if (cfg.RasterizerMultiply != 1.0f)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, rect.x, rect.y, rect.w, rect.h, atlas->TexWidth * 1);
+    }
+    ImFontAtlasBuildUpdateTexRect(atlas, rect.x, rect.y, rect.w, rect.h);
+
+    // Register glyph
+    const float font_off_x = cfg.GlyphOffset.x;
+    const float font_off_y = cfg.GlyphOffset.y + IM_ROUND(cfg.DstFont->Ascent);
+    stbtt_aligned_quad q;
+    float unused_x = 0.0f, unused_y = 0.0f;
+    stbtt_GetPackedQuad(&packed_char, atlas->TexWidth, atlas->TexHeight, 0, &unused_x, &unused_y, &q, 0);
+    cfg.DstFont->AddGlyph(&cfg, codepoint, q.x0 + font_off_x, q.y0 + font_off_y, q.x1 + font_off_x, q.y1 + font_off_y, q.s0, q.t0, q.s1, q.t1, packed_char.xadvance);
+    return true;
+}
+
+static void ImFontAtlasBuildDestroyStbTruetype(ImFontAtlas* atlas)
+{
+    IM_DELETE((ImVector<stbtt_fontinfo>*)atlas->FontBuilderData);
+}
+
 const ImFontBuilderIO* ImFontAtlasGetBuilderForStbTruetype()
 {
     static ImFontBuilderIO io;
     io.FontBuilder_Build = ImFontAtlasBuildWithStbTruetype;
+    io.FontBuilder_BuildGlyph = ImFontAtlasBuildGlyphWithStbTruetype;
+    io.FontBuilder_Destroy = ImFontAtlasBuildDestroyStbTruetype;
     return &io;
 }
 
@@ -2667,14 +4087,200 @@ void ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* f
         font->ContainerAtlas = atlas;
         font->Ascent = ascent;
         font->Descent = descent;
+        font->DeferredGlyphs = font_config->Deferred && (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs);
     }
     font->ConfigDataCount++;
 }
 
-void ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opaque)
+// A horizontal band of the packing area holding rectangles of similar heights, filled from left to right
+struct ImFontAtlasPackShelf
+{
+    int                 Y;
+    int                 Height;
+    int                 UsedWidth;
+    int                 NextOpen;           // Next shelf in the open list of the same height, -1 if last
+};
+
+// Rectangle packer used by font atlas builders. Successive calls to ImFontAtlasBuildPackRects() place rectangles in the same area.
+// - Default: stb_rectpack skyline packer. Placing a rectangle scans the skyline, which has up to 'width' nodes.
+// - ImFontAtlasFlags_PackShelves: rectangles are sorted by height and placed on shelves. Shelves with free width are kept in a list
+//   per height (bucketed free lists), so placing a rectangle only checks shelves of a few heights regardless of how many were opened.
+//   A shelf leaves its list when the narrowest rectangle remaining in the pass can't fit. Lists are rebuilt at the beginning of each pass.
+struct ImFontAtlasRectPacker
+{
+    int                 Width;
+    int                 Height;
+    bool                UseShelves;
+    stbrp_context       Context;            // Skyline packer
+    ImVector<stbrp_node> Nodes;
+    ImVector<ImFontAtlasPackShelf> Shelves; // Shelf packer
+    ImVector<int>       OpenShelvesByHeight;// First shelf of the open list for each height, -1 if none
+    int                 ShelvesBottom;      // Y of the next shelf to open
+};
+
+ImFontAtlasRectPacker* ImFontAtlasBuildPackBegin(ImFontAtlas* atlas, int width, int height)
+{
+    IM_ASSERT(width > 0 && height > 0);
+    ImFontAtlasRectPacker* packer = IM_NEW(ImFontAtlasRectPacker)();
+    packer->Width = width;
+    packer->Height = height;
+    packer->UseShelves = (atlas->Flags & ImFontAtlasFlags_PackShelves) != 0;
+    packer->ShelvesBottom = 0;
+    if (!packer->UseShelves)
+    {
+        packer->Nodes.resize(width);
+        stbrp_init_target(&packer->Context, width, height, packer->Nodes.Data, packer->Nodes.Size);
+    }
+    return packer;
+}
+
+void ImFontAtlasBuildPackEnd(ImFontAtlasRectPacker* packer)
+{
+    IM_DELETE(packer);
+}
+
+// Same order as stb_rectpack: taller first, then wider first. Compare addresses last to get a deterministic result.
+static int IMGUI_CDECL ImFontAtlasPackShelvesCompare(const void* lhs, const void* rhs)
+{
+    const stbrp_rect* a = *(const stbrp_rect* const*)lhs;
+    const stbrp_rect* b = *(const stbrp_rect* const*)rhs;
+    if (a->h != b->h)
+        return (a->h > b->h) ? -1 : +1;
+    if (a->w != b->w)
+        return (a->w > b->w) ? -1 : +1;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+// Place a rectangle on an open shelf of height in [min_h, max_h] with enough free width.
+// Shelves with less free width than 'keep_min_w' (narrowest rectangle remaining after this one) are removed from their list on the way.
+static bool ImFontAtlasPackShelvesFind(ImFontAtlasRectPacker* packer, stbrp_rect* r, int min_h, int max_h, int keep_min_w)
+{
+    max_h = ImMin(max_h, packer->OpenShelvesByHeight.Size - 1);
+    for (int shelf_h = min_h; shelf_h <= max_h; shelf_h++)
+    {
+        int* p_shelf_i = &packer->OpenShelvesByHeight[shelf_h];
+        while (*p_shelf_i != -1)
+        {
+            ImFontAtlasPackShelf& shelf = packer->Shelves[*p_shelf_i];
+            const int free_w = packer->Width - shelf.UsedWidth;
+            if (free_w >= r->w)
+            {
+                r->x = shelf.UsedWidth;
+                r->y = shelf.Y;
+                shelf.UsedWidth += r->w;
+                if (free_w - r->w < keep_min_w)
+                    *p_shelf_i = shelf.NextOpen;
+                return true;
+            }
+            if (free_w < keep_min_w)
+                *p_shelf_i = shelf.NextOpen;
+            else
+                p_shelf_i = &shelf.NextOpen;
+        }
+    }
+    return false;
+}
+
+static void ImFontAtlasPackShelves(ImFontAtlasRectPacker* packer, stbrp_rect* rects, int rects_count)
+{
+    ImVector<stbrp_rect*> sorted_rects;
+    sorted_rects.resize(rects_count);
+    for (int i = 0; i < rects_count; i++)
+        sorted_rects[i] = &rects[i];
+    ImQsort(sorted_rects.Data, (size_t)sorted_rects.Size, sizeof(stbrp_rect*), ImFontAtlasPackShelvesCompare);
+
+    // Narrowest rectangle after each one in placement order: a shelf with less free width can't be used anymore during this pass.
+    // Total width of rectangles of same height from each one: estimate how much of a new shelf they would fill.
+    ImVector<int> min_w_after, same_h_w_from;
+    min_w_after.resize(rects_count + 1);
+    same_h_w_from.resize(rects_count + 1);
+    min_w_after[rects_count] = INT_MAX;
+    same_h_w_from[rects_count] = 0;
+    for (int i = rects_count - 1; i >= 0; i--)
+    {
+        const stbrp_rect* r = sorted_rects[i];
+        min_w_after[i] = (r->w > 0 && r->h > 0) ? ImMin(min_w_after[i + 1], (int)r->w) : min_w_after[i + 1];
+        same_h_w_from[i] = (i + 1 < rects_count && sorted_rects[i + 1]->h == r->h) ? ImMin(same_h_w_from[i + 1] + r->w, packer->Width) : r->w;
+    }
+
+    // Rebuild open lists with shelves which can fit the narrowest rectangle (shelves removed during previous passes may fit narrower rectangles of this pass).
+    // Newest shelves come first, as they have the most free width.
+    for (int shelf_h = 0; shelf_h < packer->OpenShelvesByHeight.Size; shelf_h++)
+        packer->OpenShelvesByHeight[shelf_h] = -1;
+    for (int shelf_i = 0; shelf_i < packer->Shelves.Size; shelf_i++)
+    {
+        ImFontAtlasPackShelf& shelf = packer->Shelves[shelf_i];
+        if (packer->Width - shelf.UsedWidth < min_w_after[0])
+            continue;
+        shelf.NextOpen = packer->OpenShelvesByHeight[shelf.Height];
+        packer->OpenShelvesByHeight[shelf.Height] = shelf_i;
+    }
+
+    for (int i = 0; i < sorted_rects.Size; i++)
+    {
+        stbrp_rect* r = sorted_rects[i];
+        r->was_packed = 1;
+        if (r->w == 0 || r->h == 0)
+        {
+            r->x = r->y = 0; // Like stb_rectpack: empty rectangles need no space
+            continue;
+        }
+        if (r->w > packer->Width || r->h > packer->Height)
+        {
+            r->was_packed = 0;
+            continue;
+        }
+
+        // Reuse a shelf slightly taller than the rectangle (up to 1/8 of its height wasted), else a shelf up to 1/4 taller when rectangles of this height
+        // would leave more of a new shelf empty than they waste above them, else open a new shelf, else when the area is full use any shelf with room left.
+        const int keep_min_w = min_w_after[i + 1];
+        if (ImFontAtlasPackShelvesFind(packer, r, r->h, r->h + r->h / 8, keep_min_w))
+            continue;
+        const int same_h_w = same_h_w_from[i];
+        if (same_h_w < packer->Width && ImFontAtlasPackShelvesFind(packer, r, r->h + r->h / 8 + 1, r->h + ImMin(r->h / 4, (int)((ImS64)(packer->Width - same_h_w) * r->h / same_h_w)), keep_min_w))
+            continue;
+        if (packer->ShelvesBottom + r->h <= packer->Height)
+        {
+            if (packer->OpenShelvesByHeight.Size <= r->h)
+            {
+                const int old_size = packer->OpenShelvesByHeight.Size;
+                packer->OpenShelvesByHeight.resize(r->h + 1);
+                for (int n = old_size; n < packer->OpenShelvesByHeight.Size; n++)
+                    packer->OpenShelvesByHeight[n] = -1;
+            }
+            ImFontAtlasPackShelf shelf = { packer->ShelvesBottom, r->h, r->w, -1 };
+            if (packer->Width - shelf.UsedWidth >= keep_min_w)
+            {
+                shelf.NextOpen = packer->OpenShelvesByHeight[r->h];
+                packer->OpenShelvesByHeight[r->h] = packer->Shelves.Size;
+            }
+            packer->ShelvesBottom += r->h;
+            packer->Shelves.push_back(shelf);
+            r->x = 0;
+            r->y = shelf.Y;
+            continue;
+        }
+        if (ImFontAtlasPackShelvesFind(packer, r, r->h + r->h / 8 + 1, packer->OpenShelvesByHeight.Size - 1, keep_min_w))
+            continue;
+        r->was_packed = 0;
+    }
+}
+
+// Set 'x', 'y' and 'was_packed' of each rectangle.
+void ImFontAtlasBuildPackRects(ImFontAtlasRectPacker* packer, void* stbrp_rects_opaque, int rects_count)
+{
+    stbrp_rect* rects = (stbrp_rect*)stbrp_rects_opaque;
+    if (rects_count <= 0)
+        return;
+    if (packer->UseShelves)
+        ImFontAtlasPackShelves(packer, rects, rects_count);
+    else
+        stbrp_pack_rects(&packer->Context, rects, rects_count);
+}
+
+void ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, ImFontAtlasRectPacker* packer)
 {
-    stbrp_context* pack_context = (stbrp_context*)stbrp_context_opaque;
-    IM_ASSERT(pack_context != NULL);
+    IM_ASSERT(packer != NULL);
 
     ImVector<ImFontAtlasCustomRect>& user_rects = atlas->CustomRects;
     IM_ASSERT(user_rects.Size >= 1); // We expect at least the default custom rects to be registered, else something went wrong.
@@ -2687,18 +4293,95 @@ void ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opa
     memset(pack_rects.Data, 0, (size_t)pack_rects.size_in_bytes());
     for (int i = 0; i < user_rects.Size; i++)
     {
-        pack_rects[i].w = user_rects[i].Width;
-        pack_rects[i].h = user_rects[i].Height;
+        pack_rects[i].w = user_rects[i].Width;
+        pack_rects[i].h = user_rects[i].Height;
+    }
+    ImFontAtlasBuildPackRects(packer, pack_rects.Data, pack_rects.Size);
+    for (int i = 0; i < pack_rects.Size; i++)
+        if (pack_rects[i].was_packed)
+        {
+            user_rects[i].X = (unsigned short)pack_rects[i].x;
+            user_rects[i].Y = (unsigned short)pack_rects[i].y;
+            IM_ASSERT(pack_rects[i].w == user_rects[i].Width && pack_rects[i].h == user_rects[i].Height);
+            atlas->TexHeight = ImMax(atlas->TexHeight, pack_rects[i].y + pack_rects[i].h);
+        }
+}
+
+// Pack rectangles which didn't fit in the first texture page (ImFontAtlas::TexMaxHeight) into additional pages of the same size,
+// then signed distance field glyphs (ImFontConfig::SDF, flagged by the builder with stbrp_rect::id != 0 and left non-packed) into their own pages.
+// The page of each rectangle is stored in stbrp_rect::id, so builders are expected to zero-clear rectangles.
+// Pages are registered in atlas->TexExtraPages[] (pixels are allocated by ImFontAtlasBuildAllocExtraPages()). Return the number of pages.
+int ImFontAtlasBuildPackExtraPages(ImFontAtlas* atlas, void* stbrp_rects_opaque, int rects_count)
+{
+    stbrp_rect* rects = (stbrp_rect*)stbrp_rects_opaque;
+    IM_ASSERT(atlas->TexExtraPages.Size == 0);
+    const int TEX_HEIGHT_MAX = 1024 * 32;
+    const int page_height = (atlas->TexMaxHeight > 0) ? atlas->TexMaxHeight : TEX_HEIGHT_MAX;
+
+    ImVector<stbrp_rect> page_rects;
+    ImVector<int> page_rects_src;
+    for (int pass = 0; pass < 2; pass++)
+    {
+        const bool sdf = (pass == 1);
+        if (!sdf && atlas->TexMaxHeight <= 0)
+            continue; // Without TexMaxHeight, regular glyphs which didn't fit are left non-packed, like a single page build would
+        for (;;)
+        {
+            page_rects.resize(0);
+            page_rects_src.resize(0);
+            for (int rect_i = 0; rect_i < rects_count; rect_i++)
+                if (!rects[rect_i].was_packed && (rects[rect_i].id != 0) == sdf)
+                {
+                    page_rects.push_back(rects[rect_i]);
+                    page_rects_src.push_back(rect_i);
+                }
+            if (page_rects.Size == 0)
+                break;
+            const int page_n = 1 + atlas->TexExtraPages.Size;
+            IM_ASSERT(page_n < 256 && "Too many texture pages. Increase TexMaxHeight or TexDesiredWidth."); // Limited by ImFontGlyph::TexPage
+            if (page_n >= 256)
+                break;
+
+            ImFontAtlasRectPacker* packer = ImFontAtlasBuildPackBegin(atlas, atlas->TexWidth - atlas->TexGlyphPadding, page_height - atlas->TexGlyphPadding);
+            ImFontAtlasBuildPackRects(packer, page_rects.Data, page_rects.Size);
+            ImFontAtlasBuildPackEnd(packer);
+            int packed_count = 0;
+            for (int n = 0; n < page_rects.Size; n++)
+                if (page_rects[n].was_packed)
+                {
+                    stbrp_rect& r = rects[page_rects_src[n]];
+                    r.x = page_rects[n].x;
+                    r.y = page_rects[n].y;
+                    r.was_packed = 1;
+                    r.id = page_n;
+                    atlas->TexHeight = ImMax(atlas->TexHeight, r.y + r.h); // Only matters without TexMaxHeight: all pages share the height of the tallest one
+                    packed_count++;
+                }
+            if (packed_count == 0)
+                break; // Remaining rectangles are larger than a page: leave them non-packed, like a single page build would
+
+            ImFontAtlasTexPage page;
+            memset(&page, 0, sizeof(page));
+            page.SDF = sdf;
+            atlas->TexExtraPages.push_back(page);
+        }
+    }
+    return 1 + atlas->TexExtraPages.Size;
+}
+
+// Allocate pixels of pages registered in atlas->TexExtraPages[], in the same format as the first page, which the builder already allocated.
+void ImFontAtlasBuildAllocExtraPages(ImFontAtlas* atlas)
+{
+    IM_ASSERT(atlas->TexPixelsAlpha8 != NULL || atlas->TexPixelsRGBA32 != NULL);
+    for (int page_i = 0; page_i < atlas->TexExtraPages.Size; page_i++)
+    {
+        ImFontAtlasTexPage& page = atlas->TexExtraPages[page_i];
+        IM_ASSERT(page.PixelsAlpha8 == NULL && page.PixelsRGBA32 == NULL);
+        const size_t tex_size = (size_t)atlas->TexWidth * atlas->TexHeight * (atlas->TexPixelsAlpha8 ? 1 : 4);
+        page.PixelsAlpha8 = atlas->TexPixelsAlpha8 ? (unsigned char*)IM_ALLOC(tex_size) : NULL;
+        page.PixelsRGBA32 = atlas->TexPixelsAlpha8 ? NULL : (unsigned int*)IM_ALLOC(tex_size);
+        memset(page.PixelsAlpha8 ? (void*)page.PixelsAlpha8 : (void*)page.PixelsRGBA32, 0, tex_size);
     }
-    stbrp_pack_rects(pack_context, &pack_rects[0], pack_rects.Size);
-    for (int i = 0; i < pack_rects.Size; i++)
-        if (pack_rects[i].was_packed)
-        {
-            user_rects[i].X = (unsigned short)pack_rects[i].x;
-            user_rects[i].Y = (unsigned short)pack_rects[i].y;
-            IM_ASSERT(pack_rects[i].w == user_rects[i].Width && pack_rects[i].h == user_rects[i].Height);
-            atlas->TexHeight = ImMax(atlas->TexHeight, pack_rects[i].y + pack_rects[i].h);
-        }
 }
 
 void ImFontAtlasBuildRender8bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned char in_marker_pixel_value)
@@ -2812,6 +4495,71 @@ static void ImFontAtlasBuildRenderLinesTexData(ImFontAtlas* atlas)
     }
 }
 
+// Baked rounded corners are stored as one quarter disc per 0.5 radius step, packed in rows from largest to smallest radius.
+// Each quarter disc is (ceil(radius) + 3) texels wide: the first row/column mirrors the second one so that sampling on the
+// edge between them gives the coverage along the axes, and the last ones leave room for the AA fringe and bilinear filtering.
+static inline int ImFontAtlasBuildRoundCornersCalcTexSize(int radius_x2) { return (radius_x2 + 1) / 2 + 3; }
+
+static ImVec2ih ImFontAtlasBuildRoundCornersCalcLayout(ImVec2ih* out_offsets)
+{
+    const int pack_width = ImMax(128, ImFontAtlasBuildRoundCornersCalcTexSize(IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX * 2));
+    int x = 0, y = 0, row_height = 0, max_width = 0;
+    for (int n = IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX * 2; n >= 1; n--)
+    {
+        const int size = ImFontAtlasBuildRoundCornersCalcTexSize(n);
+        if (x + size > pack_width)
+        {
+            x = 0;
+            y += row_height;
+            row_height = 0;
+        }
+        if (out_offsets != NULL)
+            out_offsets[n] = ImVec2ih((short)x, (short)y);
+        x += size;
+        row_height = ImMax(row_height, size);
+        max_width = ImMax(max_width, x);
+    }
+    return ImVec2ih((short)max_width, (short)(y + row_height));
+}
+
+static void ImFontAtlasBuildRenderRoundCornersTexData(ImFontAtlas* atlas)
+{
+    if (atlas->Flags & ImFontAtlasFlags_NoBakedRoundCorners)
+        return;
+
+    // This generates a quarter of an anti-aliased disc for each radius, with its center on the top-left corner.
+    // Coverage matches the one of the polygon-based AA fill path: 1.0f up to (radius - 0.5f), fading to 0.0f at (radius + 0.5f).
+    ImFontAtlasCustomRect* r = atlas->GetCustomRectByIndex(atlas->PackIdRoundCorners);
+    IM_ASSERT(r->IsPacked());
+    ImVec2ih offsets[IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX * 2 + 1];
+    ImFontAtlasBuildRoundCornersCalcLayout(offsets);
+    for (int n = 1; n <= IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX * 2; n++)
+    {
+        const float radius = n * 0.5f;
+        const int size = ImFontAtlasBuildRoundCornersCalcTexSize(n);
+        const int x0 = r->X + offsets[n].x;
+        const int y0 = r->Y + offsets[n].y;
+        IM_ASSERT(offsets[n].x + size <= r->Width && offsets[n].y + size <= r->Height); // Make sure we're inside the texture bounds before we start writing pixels
+        for (int y = 0; y < size; y++)
+            for (int x = 0; x < size; x++)
+            {
+                const float dx = ImMax(x - 1, 0) + 0.5f;
+                const float dy = ImMax(y - 1, 0) + 0.5f;
+                const float alpha = ImSaturate(radius + 0.5f - ImSqrt(dx * dx + dy * dy));
+                const int offset = x0 + x + (y0 + y) * atlas->TexWidth;
+                if (atlas->TexPixelsAlpha8 != NULL)
+                    atlas->TexPixelsAlpha8[offset] = (unsigned char)(alpha * 255.0f + 0.5f);
+                else
+                    atlas->TexPixelsRGBA32[offset] = IM_COL32(255, 255, 255, (int)(alpha * 255.0f + 0.5f));
+            }
+
+        // Calculate UVs for this radius
+        const ImVec2 uv0 = ImVec2((float)(x0 + 1), (float)(y0 + 1)) * atlas->TexUvScale;
+        const ImVec2 uv1 = ImVec2((float)(x0 + 1) + radius + 1.0f, (float)(y0 + 1) + radius + 1.0f) * atlas->TexUvScale;
+        atlas->TexUvRoundCorners[n] = ImVec4(uv0.x, uv0.y, uv1.x, uv1.y);
+    }
+}
+
 // Note: this is called / shared by both the stb_truetype and the FreeType builder
 void ImFontAtlasBuildInit(ImFontAtlas* atlas)
 {
@@ -2831,6 +4579,16 @@ void ImFontAtlasBuildInit(ImFontAtlas* atlas)
         if (!(atlas->Flags & ImFontAtlasFlags_NoBakedLines))
             atlas->PackIdLines = atlas->AddCustomRectRegular(IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 2, IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1);
     }
+
+    // Register texture region for filled circles and rounded corners
+    if (atlas->PackIdRoundCorners < 0)
+    {
+        if (!(atlas->Flags & ImFontAtlasFlags_NoBakedRoundCorners))
+        {
+            const ImVec2ih size = ImFontAtlasBuildRoundCornersCalcLayout(NULL);
+            atlas->PackIdRoundCorners = atlas->AddCustomRectRegular(size.x, size.y);
+        }
+    }
 }
 
 // This is called/shared by both the stb_truetype and the FreeType builder.
@@ -2840,6 +4598,7 @@ void ImFontAtlasBuildFinish(ImFontAtlas* atlas)
     IM_ASSERT(atlas->TexPixelsAlpha8 != NULL || atlas->TexPixelsRGBA32 != NULL);
     ImFontAtlasBuildRenderDefaultTexData(atlas);
     ImFontAtlasBuildRenderLinesTexData(atlas);
+    ImFontAtlasBuildRenderRoundCornersTexData(atlas);
 
     // Register custom rectangle glyphs
     for (int i = 0; i < atlas->CustomRects.Size; i++)
@@ -2863,6 +4622,203 @@ void ImFontAtlasBuildFinish(ImFontAtlas* atlas)
     atlas->TexReady = true;
 }
 
+// Free space left at the bottom of the texture after Build(), used to rasterize glyphs on demand (ImFontAtlasFlags_DynamicGlyphs)
+struct ImFontAtlasDynamicPacker
+{
+    ImFontAtlasRectPacker* Packer;          // Created on first use
+    int                 OffsetY;            // Packing area starts after the glyphs and custom rectangles packed by Build()
+
+    ImFontAtlasDynamicPacker()  { Packer = NULL; OffsetY = 0; }
+    ~ImFontAtlasDynamicPacker() { if (Packer) ImFontAtlasBuildPackEnd(Packer); }
+};
+
+// Called by builders before finalizing TexHeight: reserve free space below the packed data.
+// We make the texture at least square (texture width is bumped to 1024 minimum in this mode) and at least twice the packed height.
+// ImFontConfig::Deferred sources get room for the glyphs ImFont::LoadDeferredGlyphs() will rasterize on top of that. Their size is estimated
+// from the number of requested code-points and the font size (an average glyph box is about 0.4 x 0.7 em), which tends to overestimate a little.
+void ImFontAtlasBuildReserveDynamicSpace(ImFontAtlas* atlas)
+{
+    IM_ASSERT(atlas->Flags & ImFontAtlasFlags_DynamicGlyphs);
+    IM_ASSERT(atlas->DynamicPacker == NULL);
+    int deferred_surface = 0;
+    for (int font_i = 0; font_i < atlas->Fonts.Size; font_i++)
+    {
+        // Code-points requested by several merged sources are counted once, for the first source (as it will provide the glyph)
+        ImBitArray<IM_FONTATLAS_DYNAMIC_GLYPHS_PRELOAD_MAX + 1> requested;
+        for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
+        {
+            const ImFontConfig& cfg = atlas->ConfigData[src_i];
+            if (cfg.DstFont != atlas->Fonts[font_i] || !cfg.Deferred)
+                continue;
+            int glyphs_count = 0;
+            for (const ImWchar* src_range = cfg.GlyphRanges ? cfg.GlyphRanges : atlas->GetGlyphRangesDefault(); src_range[0] && src_range[1]; src_range += 2)
+                for (unsigned int codepoint = src_range[0]; codepoint <= src_range[1] && codepoint <= IM_FONTATLAS_DYNAMIC_GLYPHS_PRELOAD_MAX; codepoint++)
+                    if (!requested.TestBit((int)codepoint))
+                    {
+                        requested.SetBit((int)codepoint);
+                        glyphs_count++;
+                    }
+            const int glyph_w = (int)(cfg.SizePixels * 0.4f * cfg.OversampleH) + atlas->TexGlyphPadding + cfg.OversampleH;
+            const int glyph_h = (int)(cfg.SizePixels * 0.7f * cfg.OversampleV) + atlas->TexGlyphPadding + cfg.OversampleV;
+            deferred_surface += glyphs_count * glyph_w * glyph_h;
+        }
+    }
+    ImFontAtlasDynamicPacker* packer = IM_NEW(ImFontAtlasDynamicPacker)();
+    packer->OffsetY = atlas->TexHeight;
+    atlas->DynamicPacker = packer;
+    atlas->TexHeight = ImMax(atlas->TexHeight * 2 + deferred_surface / atlas->TexWidth, atlas->TexWidth); // Clamped to TexMaxHeight by the builder
+}
+
+// Allocate a rectangle in the free space. Like the rectangles packed by Build(), 'w' and 'h' include TexGlyphPadding
+// and the padding is on the top-left side. Returns false when the texture is full.
+bool ImFontAtlasBuildAllocDynamicRect(ImFontAtlas* atlas, int w, int h, int* out_x, int* out_y)
+{
+    ImFontAtlasDynamicPacker* packer = (ImFontAtlasDynamicPacker*)atlas->DynamicPacker;
+    if (packer == NULL)
+        return false;
+    if (packer->Packer == NULL)
+    {
+        // Lazily initialize now that TexHeight is final
+        const int pack_w = atlas->TexWidth - atlas->TexGlyphPadding;
+        const int pack_h = atlas->TexHeight - packer->OffsetY - atlas->TexGlyphPadding;
+        if (pack_w <= 0 || pack_h <= 0)
+            return false;
+        packer->Packer = ImFontAtlasBuildPackBegin(atlas, pack_w, pack_h);
+    }
+    stbrp_rect r = {};
+    r.w = (stbrp_coord)w;
+    r.h = (stbrp_coord)h;
+    ImFontAtlasBuildPackRects(packer->Packer, &r, 1);
+    if (!r.was_packed)
+        return false;
+    *out_x = r.x;
+    *out_y = r.y + packer->OffsetY;
+    return true;
+}
+
+// Called by builders after writing pixels into a region of the texture, after Build().
+// Mirror Alpha8 data into RGBA32 if both are present, and record the region for the backend to upload.
+void ImFontAtlasBuildUpdateTexRect(ImFontAtlas* atlas, int x, int y, int w, int h)
+{
+    IM_ASSERT(x >= 0 && x + w <= atlas->TexWidth);
+    IM_ASSERT(y >= 0 && y + h <= atlas->TexHeight);
+    if (w <= 0 || h <= 0)
+        return;
+    if (atlas->TexPixelsAlpha8 != NULL && atlas->TexPixelsRGBA32 != NULL)
+        for (int off_y = 0; off_y < h; off_y++)
+        {
+            const unsigned char* src = atlas->TexPixelsAlpha8 + (y + off_y) * atlas->TexWidth + x;
+            unsigned int* dst = atlas->TexPixelsRGBA32 + (y + off_y) * atlas->TexWidth + x;
+            for (int n = w; n > 0; n--)
+                *dst++ = IM_COL32(255, 255, 255, (unsigned int)(*src++));
+        }
+
+    // Merge with last rectangle when it doesn't waste too much area (consecutive glyphs tend to be packed next to each other)
+    if (atlas->TexDirtyRects.Size > 0)
+    {
+        ImFontAtlasDirtyRect& last = atlas->TexDirtyRects.back();
+        const int x0 = ImMin(x, (int)last.X), y0 = ImMin(y, (int)last.Y);
+        const int x1 = ImMax(x + w, last.X + last.Width), y1 = ImMax(y + h, last.Y + last.Height);
+        if ((x1 - x0) * (y1 - y0) <= (w * h + last.Width * last.Height) * 2)
+        {
+            last.X = (unsigned short)x0;
+            last.Y = (unsigned short)y0;
+            last.Width = (unsigned short)(x1 - x0);
+            last.Height = (unsigned short)(y1 - y0);
+            return;
+        }
+    }
+    ImFontAtlasDirtyRect r = { (unsigned short)x, (unsigned short)y, (unsigned short)w, (unsigned short)h };
+    atlas->TexDirtyRects.push_back(r);
+}
+
+#ifdef IMGUI_ENABLE_FONT_BUILD_THREADS
+// Default for ImFontAtlas::BuildParallelForFunc: the calling thread and up to one worker thread per core pick jobs in order until none are left.
+static void ImFontAtlasBuildParallelForWithThreads(void (*job_func)(void* job_data, int job_index), void* job_data, int job_count)
+{
+    std::atomic<int> next_job_index(0);
+    auto worker_func = [&]() { for (int job_index = next_job_index++; job_index < job_count; job_index = next_job_index++) job_func(job_data, job_index); };
+    std::thread threads[31];
+    const int threads_count = ImMin(ImMin((int)std::thread::hardware_concurrency(), job_count) - 1, IM_ARRAYSIZE(threads));
+    for (int n = 0; n < threads_count; n++)
+        threads[n] = std::thread(worker_func);
+    worker_func();
+    for (int n = 0; n < threads_count; n++)
+        threads[n].join();
+}
+#endif
+
+// Run build jobs using ImFontAtlas::BuildParallelForFunc, or std::thread with IMGUI_ENABLE_FONT_BUILD_THREADS, or serially on the calling thread.
+// Jobs may run concurrently: they should only write to their own outputs (allocated before running them), and not call IM_ALLOC()/IM_FREE()
+// as they update io.MetricsActiveAllocations (which also excludes growing an ImVector<>).
+void ImFontAtlasBuildParallelFor(ImFontAtlas* atlas, void (*job_func)(void* job_data, int job_index), void* job_data, int job_count)
+{
+    if (job_count > 1 && atlas->BuildParallelForFunc != NULL)
+        atlas->BuildParallelForFunc(job_func, job_data, job_count, atlas->BuildParallelForUserData);
+#ifdef IMGUI_ENABLE_FONT_BUILD_THREADS
+    else if (job_count > 1)
+        ImFontAtlasBuildParallelForWithThreads(job_func, job_data, job_count);
+#endif
+    else
+        for (int job_index = 0; job_index < job_count; job_index++)
+            job_func(job_data, job_index);
+}
+
+void ImFontAtlasBuildClearDynamicData(ImFontAtlas* atlas)
+{
+    if (atlas->FontBuilderData != NULL)
+    {
+        IM_ASSERT(atlas->FontBuilderIOUsed != NULL && atlas->FontBuilderIOUsed->FontBuilder_Destroy != NULL);
+        atlas->FontBuilderIOUsed->FontBuilder_Destroy(atlas);
+        atlas->FontBuilderData = NULL;
+    }
+    if (atlas->DynamicPacker != NULL)
+        IM_DELETE((ImFontAtlasDynamicPacker*)atlas->DynamicPacker);
+    atlas->DynamicPacker = NULL;
+    atlas->TexDirtyRects.clear();
+}
+
+// Map font files again after ImFontAtlasBuildReleaseFontData(), before reading ImFontConfig::FontData
+bool ImFontAtlasBuildMapFontData(ImFontAtlas* atlas)
+{
+    bool ret = true;
+    for (int i = 0; i < atlas->ConfigData.Size; i++)
+    {
+        ImFontConfig& cfg = atlas->ConfigData[i];
+        if (cfg.FontDataFile == NULL || cfg.FontData != NULL)
+            continue;
+        size_t data_size = 0;
+        cfg.FontData = ImFileMapToMemory(cfg.FontDataFile, &data_size);
+        if (cfg.FontData != NULL && data_size != (size_t)cfg.FontDataSize)
+        {
+            ImFileUnmapFromMemory(cfg.FontData, data_size); // File was truncated or overwritten in place since AddFontFromFileTTF()
+            cfg.FontData = NULL;
+        }
+        if (cfg.FontData == NULL)
+        {
+            IM_ASSERT_USER_ERROR(0, "Font file was modified since AddFontFromFileTTF(), could not map it again!");
+            ret = false;
+        }
+    }
+    return ret;
+}
+
+// Unmap font files once the atlas is built. Kept while the font builder is alive to rasterize glyphs on demand (ImFontAtlasFlags_DynamicGlyphs).
+void ImFontAtlasBuildReleaseFontData(ImFontAtlas* atlas)
+{
+    if (atlas->FontBuilderData != NULL)
+        return;
+    for (int i = 0; i < atlas->ConfigData.Size; i++)
+    {
+        ImFontConfig& cfg = atlas->ConfigData[i];
+        if (cfg.FontDataFile != NULL && cfg.FontData != NULL)
+        {
+            ImFileUnmapFromMemory(cfg.FontData, (size_t)cfg.FontDataSize);
+            cfg.FontData = NULL;
+        }
+    }
+}
+
 // Retrieve list of range (2 int per range, values are inclusive)
 const ImWchar*   ImFontAtlas::GetGlyphRangesDefault()
 {
@@ -3187,6 +5143,11 @@ ImFont::ImFont()
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
     memset(Used4kPagesMap, 0, sizeof(Used4kPagesMap));
+    memset(AsciiAdvanceX, 0, sizeof(AsciiAdvanceX));
+    memset(AsciiGlyphIndex, 0, sizeof(AsciiGlyphIndex));
+    AsciiFastPath = false;
+    LookupTablesVersion = 0;
+    DeferredGlyphs = false;
 }
 
 ImFont::~ImFont()
@@ -3199,11 +5160,13 @@ void    ImFont::ClearOutputData()
     FontSize = 0.0f;
     FallbackAdvanceX = 0.0f;
     Glyphs.clear();
-    IndexAdvanceX.clear();
-    IndexLookup.clear();
+    IndexPageMap.clear();
+    IndexPages.clear();
     FallbackGlyph = NULL;
     ContainerAtlas = NULL;
     DirtyLookupTables = true;
+    AsciiFastPath = false;
+    DeferredGlyphs = false;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
 }
@@ -3216,24 +5179,50 @@ static ImWchar FindFirstExistingGlyph(ImFont* font, const ImWchar* candidate_cha
     return (ImWchar)-1;
 }
 
+// Shared by all fonts so that a font allocated at the address of a destroyed one never reuses a value.
+// Atomic with IMGUI_ENABLE_FONT_BUILD_THREADS, where fonts may be built on several threads.
+#ifdef IMGUI_ENABLE_FONT_BUILD_THREADS
+static std::atomic<ImU32> GImFontLookupTablesVersion(0);
+#else
+static ImU32 GImFontLookupTablesVersion = 0;
+#endif
+
 void ImFont::BuildLookupTable()
 {
+    LookupTablesVersion = ++GImFontLookupTablesVersion;
+    if (DeferredGlyphs)
+    {
+        // ImFontConfig::Deferred: resolve every code-point to IM_FONTGLYPH_INDEX_NOT_LOADED through the shared page 0,
+        // and leave a negative FallbackAdvanceX for code-points above the index, so the first lookup calls LoadGlyph().
+        IndexPageMap.clear();
+        IndexPages.clear();
+        DirtyLookupTables = false;
+        AsciiFastPath = false;
+        memset(Used4kPagesMap, 0, sizeof(Used4kPagesMap));
+        GrowIndex(IM_UNICODE_CODEPOINT_MAX + 1);
+        for (int n = 0; n < IM_FONT_INDEX_PAGE_SIZE; n++)
+            IndexPages[0].Lookup[n] = IM_FONTGLYPH_INDEX_NOT_LOADED;
+        FallbackGlyph = NULL;
+        FallbackAdvanceX = -1.0f;
+        return;
+    }
     int max_codepoint = 0;
     for (int i = 0; i != Glyphs.Size; i++)
         max_codepoint = ImMax(max_codepoint, (int)Glyphs[i].Codepoint);
 
     // Build lookup table
-    IM_ASSERT(Glyphs.Size < 0xFFFF); // -1 is reserved
-    IndexAdvanceX.clear();
-    IndexLookup.clear();
+    IM_ASSERT(Glyphs.Size < 0xFFFE); // -1 and -2 are reserved (IM_FONTGLYPH_INDEX_UNUSED, IM_FONTGLYPH_INDEX_NOT_LOADED)
+    IndexPageMap.clear();
+    IndexPages.clear();
     DirtyLookupTables = false;
     memset(Used4kPagesMap, 0, sizeof(Used4kPagesMap));
     GrowIndex(max_codepoint + 1);
     for (int i = 0; i < Glyphs.Size; i++)
     {
         int codepoint = (int)Glyphs[i].Codepoint;
-        IndexAdvanceX[codepoint] = Glyphs[i].AdvanceX;
-        IndexLookup[codepoint] = (ImWchar)i;
+        ImFontIndexPage* index_page = GetOrAddIndexPage((unsigned int)codepoint);
+        index_page->AdvanceX[codepoint % IM_FONT_INDEX_PAGE_SIZE] = Glyphs[i].AdvanceX;
+        index_page->Lookup[codepoint % IM_FONT_INDEX_PAGE_SIZE] = (ImWchar)i;
 
         // Mark 4K page as used
         const int page_n = codepoint / 4096;
@@ -3250,10 +5239,33 @@ void ImFont::BuildLookupTable()
         tab_glyph = *FindGlyph((ImWchar)' ');
         tab_glyph.Codepoint = '\t';
         tab_glyph.AdvanceX *= IM_TABSIZE;
-        IndexAdvanceX[(int)tab_glyph.Codepoint] = (float)tab_glyph.AdvanceX;
-        IndexLookup[(int)tab_glyph.Codepoint] = (ImWchar)(Glyphs.Size - 1);
+        ImFontIndexPage* index_page = GetOrAddIndexPage(tab_glyph.Codepoint);
+        index_page->AdvanceX[tab_glyph.Codepoint % IM_FONT_INDEX_PAGE_SIZE] = (float)tab_glyph.AdvanceX;
+        index_page->Lookup[tab_glyph.Codepoint % IM_FONT_INDEX_PAGE_SIZE] = (ImWchar)(Glyphs.Size - 1);
     }
 
+    // With ImFontAtlasFlags_DynamicGlyphs: mark codepoints requested by our sources but not rasterized yet.
+    // Their negative advance tells CalcTextSizeA() and FindGlyph() to call LoadGlyph() on first use.
+    ImFontAtlas* atlas = ContainerAtlas;
+    if (atlas != NULL && (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs) && atlas->FontBuilderData != NULL)
+        for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
+        {
+            const ImFontConfig& src_cfg = atlas->ConfigData[src_i];
+            if (src_cfg.DstFont != this)
+                continue;
+            for (const ImWchar* src_range = src_cfg.GlyphRanges ? src_cfg.GlyphRanges : atlas->GetGlyphRangesDefault(); src_range[0] && src_range[1]; src_range += 2)
+            {
+                if (src_range[1] <= IM_FONTATLAS_DYNAMIC_GLYPHS_PRELOAD_MAX)
+                    continue;
+                for (unsigned int codepoint = ImMax((unsigned int)src_range[0], (unsigned int)IM_FONTATLAS_DYNAMIC_GLYPHS_PRELOAD_MAX + 1); codepoint <= src_range[1]; codepoint++)
+                {
+                    ImFontIndexPage* index_page = GetOrAddIndexPage(codepoint);
+                    if (index_page->Lookup[codepoint % IM_FONT_INDEX_PAGE_SIZE] == IM_FONTGLYPH_INDEX_UNUSED)
+                        index_page->Lookup[codepoint % IM_FONT_INDEX_PAGE_SIZE] = IM_FONTGLYPH_INDEX_NOT_LOADED;
+                }
+            }
+        }
+
     // Mark special glyphs as not visible (note that AddGlyph already mark as non-visible glyphs with zero-size polygons)
     SetGlyphVisible((ImWchar)' ', false);
     SetGlyphVisible((ImWchar)'\t', false);
@@ -3272,9 +5284,13 @@ void ImFont::BuildLookupTable()
         }
     }
     FallbackAdvanceX = FallbackGlyph->AdvanceX;
-    for (int i = 0; i < max_codepoint + 1; i++)
-        if (IndexAdvanceX[i] < 0.0f)
-            IndexAdvanceX[i] = FallbackAdvanceX;
+    for (int page_i = 0; page_i < IndexPages.Size; page_i++)
+    {
+        ImFontIndexPage& index_page = IndexPages[page_i];
+        for (int n = 0; n < IM_FONT_INDEX_PAGE_SIZE; n++)
+            if (index_page.AdvanceX[n] < 0.0f && index_page.Lookup[n] != IM_FONTGLYPH_INDEX_NOT_LOADED)
+                index_page.AdvanceX[n] = FallbackAdvanceX;
+    }
 
     // Setup Ellipsis character. It is required for rendering elided text. We prefer using U+2026 (horizontal ellipsis).
     // However some old fonts may contain ellipsis at U+0085. Here we auto-detect most suitable ellipsis character.
@@ -3297,6 +5313,28 @@ void ImFont::BuildLookupTable()
         EllipsisCharStep = (glyph->X1 - glyph->X0) + 1.0f;
         EllipsisWidth = EllipsisCharStep * 3.0f - 1.0f;
     }
+
+    BuildAsciiLookupTable();
+}
+
+// Cache what FindGlyph() and GetIndexAdvanceX() resolve to for 0x20..0x7F, so CalcTextSizeA() and RenderText() can process ASCII runs without any check.
+// With ImFontAtlasFlags_DynamicGlyphs, codepoints <= IM_FONTATLAS_DYNAMIC_GLYPHS_PRELOAD_MAX are always rasterized by Build() so this doesn't need updating from LoadGlyph().
+void ImFont::BuildAsciiLookupTable()
+{
+    AsciiFastPath = false;
+    for (int c = 0x20; c < 0x80; c++)
+    {
+        const ImWchar i = GetIndexLookup((unsigned int)c);
+        const float advance_x = GetIndexAdvanceX((unsigned int)c);
+        if (i == IM_FONTGLYPH_INDEX_NOT_LOADED || advance_x < 0.0f)
+            return;
+        const ImFontGlyph* glyph = (i == IM_FONTGLYPH_INDEX_UNUSED) ? FallbackGlyph : &Glyphs.Data[i];
+        if (glyph == NULL)
+            return;
+        AsciiAdvanceX[c] = advance_x;
+        AsciiGlyphIndex[c] = (ImWchar)(glyph - Glyphs.Data);
+    }
+    AsciiFastPath = true;
 }
 
 // API is designed this way to avoid exposing the 4K page size
@@ -3320,11 +5358,35 @@ void ImFont::SetGlyphVisible(ImWchar c, bool visible)
 
 void ImFont::GrowIndex(int new_size)
 {
-    IM_ASSERT(IndexAdvanceX.Size == IndexLookup.Size);
-    if (new_size <= IndexLookup.Size)
+    const int new_map_size = (new_size + IM_FONT_INDEX_PAGE_SIZE - 1) / IM_FONT_INDEX_PAGE_SIZE;
+    if (new_map_size <= IndexPageMap.Size)
         return;
-    IndexAdvanceX.resize(new_size, -1.0f);
-    IndexLookup.resize(new_size, (ImWchar)-1);
+    if (IndexPages.empty())
+    {
+        // Page 0 is shared by all blocks without glyph. BuildLookupTable() sets its advances to FallbackAdvanceX.
+        IndexPages.resize(1);
+        for (int n = 0; n < IM_FONT_INDEX_PAGE_SIZE; n++)
+        {
+            IndexPages[0].AdvanceX[n] = -1.0f;
+            IndexPages[0].Lookup[n] = (ImWchar)-1;
+        }
+    }
+    IndexPageMap.resize(new_map_size, 0);
+}
+
+// New pages are a copy of the shared page 0, so blocks getting their first glyph keep resolving other code-points to the fallback.
+ImFontIndexPage* ImFont::GetOrAddIndexPage(unsigned int c)
+{
+    GrowIndex((int)c + 1);
+    const unsigned int page_n = c / IM_FONT_INDEX_PAGE_SIZE;
+    if (IndexPageMap.Data[page_n] == 0)
+    {
+        IM_ASSERT(IndexPages.Size < 0xFFFF);
+        IndexPages.resize(IndexPages.Size + 1);
+        memcpy(&IndexPages.back(), &IndexPages.Data[0], sizeof(ImFontIndexPage));
+        IndexPageMap.Data[page_n] = (ImU16)(IndexPages.Size - 1);
+    }
+    return &IndexPages.Data[IndexPageMap.Data[page_n]];
 }
 
 // x0/y0/x1/y1 are offset from the character upper-left layout position, in pixels. Therefore x0/y0 are often fairly close to zero.
@@ -3357,6 +5419,7 @@ void ImFont::AddGlyph(const ImFontConfig* cfg, ImWchar codepoint, float x0, floa
     glyph.Codepoint = (unsigned int)codepoint;
     glyph.Visible = (x0 != x1) && (y0 != y1);
     glyph.Colored = false;
+    glyph.TexPage = 0;
     glyph.X0 = x0;
     glyph.Y0 = y0;
     glyph.X1 = x1;
@@ -3376,36 +5439,108 @@ void ImFont::AddGlyph(const ImFontConfig* cfg, ImWchar codepoint, float x0, floa
 
 void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
 {
-    IM_ASSERT(IndexLookup.Size > 0);    // Currently this can only be called AFTER the font has been built, aka after calling ImFontAtlas::GetTexDataAs*() function.
-    unsigned int index_size = (unsigned int)IndexLookup.Size;
+    IM_ASSERT(IndexPageMap.Size > 0);   // Currently this can only be called AFTER the font has been built, aka after calling ImFontAtlas::GetTexDataAs*() function.
+    FindGlyph(src);                     // Make sure 'src' is rasterized (ImFontAtlasFlags_DynamicGlyphs)
+    unsigned int index_size = (unsigned int)IndexPageMap.Size * IM_FONT_INDEX_PAGE_SIZE;
 
-    if (dst < index_size && IndexLookup.Data[dst] == (ImWchar)-1 && !overwrite_dst) // 'dst' already exists
+    if (dst < index_size && GetIndexLookup(dst) == (ImWchar)-1 && !overwrite_dst) // 'dst' already exists
         return;
     if (src >= index_size && dst >= index_size) // both 'dst' and 'src' don't exist -> no-op
         return;
 
-    GrowIndex(dst + 1);
-    IndexLookup[dst] = (src < index_size) ? IndexLookup.Data[src] : (ImWchar)-1;
-    IndexAdvanceX[dst] = (src < index_size) ? IndexAdvanceX.Data[src] : 1.0f;
+    const ImWchar src_lookup = GetIndexLookup(src);
+    const float src_advance_x = (src < index_size) ? GetIndexAdvanceX(src) : 1.0f;
+    ImFontIndexPage* index_page = GetOrAddIndexPage(dst);
+    index_page->Lookup[dst % IM_FONT_INDEX_PAGE_SIZE] = src_lookup;
+    index_page->AdvanceX[dst % IM_FONT_INDEX_PAGE_SIZE] = src_advance_x;
+    LookupTablesVersion = ++GImFontLookupTablesVersion;
+    if (dst < 0x80)
+        BuildAsciiLookupTable();
+}
+
+// Rasterize a glyph which was marked as IM_FONTGLYPH_INDEX_NOT_LOADED by BuildLookupTable() (ImFontAtlasFlags_DynamicGlyphs).
+// Sources are tried in the same order as Build() would, so merged fonts resolve overlapping codepoints identically.
+// Note that this may reallocate Glyphs[]: don't hold on to glyph pointers across calls to FindGlyph().
+const ImFontGlyph* ImFont::LoadGlyph(ImWchar c)
+{
+    if (DeferredGlyphs)
+    {
+        LoadDeferredGlyphs();
+        return FindGlyphNoFallback(c);
+    }
+    if ((unsigned int)c / IM_FONT_INDEX_PAGE_SIZE >= (unsigned int)IndexPageMap.Size)
+        return NULL;
+    ImFontAtlas* atlas = ContainerAtlas;
+    const int glyphs_count = Glyphs.Size;
+    const int fallback_glyph_idx = FallbackGlyph ? (int)(FallbackGlyph - Glyphs.Data) : -1;
+    const bool dirty_lookup_tables = DirtyLookupTables;
+    if (atlas != NULL && atlas->FontBuilderData != NULL && atlas->FontBuilderIOUsed->FontBuilder_BuildGlyph != NULL && (atlas->TexPixelsAlpha8 != NULL || atlas->TexPixelsRGBA32 != NULL))
+    {
+        IM_ASSERT(Glyphs.Size < 0xFFFE); // -1 and -2 are reserved
+        for (int src_i = 0; src_i < atlas->ConfigData.Size && Glyphs.Size == glyphs_count; src_i++)
+        {
+            ImFontConfig* src_cfg = &atlas->ConfigData[src_i];
+            if (src_cfg->DstFont != this)
+                continue;
+            for (const ImWchar* src_range = src_cfg->GlyphRanges ? src_cfg->GlyphRanges : atlas->GetGlyphRangesDefault(); src_range[0] && src_range[1]; src_range += 2)
+                if (c >= src_range[0] && c <= src_range[1])
+                {
+                    atlas->FontBuilderIOUsed->FontBuilder_BuildGlyph(atlas, src_cfg, c);
+                    break;
+                }
+        }
+    }
+    if (fallback_glyph_idx >= 0)
+        FallbackGlyph = &Glyphs.Data[fallback_glyph_idx];
+    DirtyLookupTables = dirty_lookup_tables;
+
+    ImFontIndexPage* index_page = GetOrAddIndexPage(c);
+    if (Glyphs.Size == glyphs_count)
+    {
+        // Not available in any source: use fallback from now on
+        index_page->Lookup[c % IM_FONT_INDEX_PAGE_SIZE] = IM_FONTGLYPH_INDEX_UNUSED;
+        index_page->AdvanceX[c % IM_FONT_INDEX_PAGE_SIZE] = FallbackGlyph ? FallbackAdvanceX : -1.0f;
+        return NULL;
+    }
+    IM_ASSERT(Glyphs.Size == glyphs_count + 1 && Glyphs.back().Codepoint == c);
+    index_page->Lookup[c % IM_FONT_INDEX_PAGE_SIZE] = (ImWchar)glyphs_count;
+    index_page->AdvanceX[c % IM_FONT_INDEX_PAGE_SIZE] = Glyphs.back().AdvanceX;
+    const int page_n = c / 4096;
+    Used4kPagesMap[page_n >> 3] |= 1 << (page_n & 7);
+    return &Glyphs.back();
+}
+
+// Rasterize a ImFontConfig::Deferred font: the glyphs Build() would have rasterized (code-points <= IM_FONTATLAS_DYNAMIC_GLYPHS_PRELOAD_MAX)
+// go into the free space reserved for ImFontAtlasFlags_DynamicGlyphs, then lookup tables are built as usual. Other glyphs are still loaded on demand.
+void ImFont::LoadDeferredGlyphs()
+{
+    if (!DeferredGlyphs)
+        return;
+    DeferredGlyphs = false;
+    for (unsigned int c = 0; c <= IM_FONTATLAS_DYNAMIC_GLYPHS_PRELOAD_MAX; c++)
+        if (GetIndexLookup(c) == IM_FONTGLYPH_INDEX_NOT_LOADED)
+            LoadGlyph((ImWchar)c);
+    IM_ASSERT(Glyphs.Size > 0 && "Could not rasterize deferred font: not enough free space in the atlas texture?");
+    if (Glyphs.Size > 0)
+        BuildLookupTable();
 }
 
 const ImFontGlyph* ImFont::FindGlyph(ImWchar c) const
 {
-    if (c >= (size_t)IndexLookup.Size)
-        return FallbackGlyph;
-    const ImWchar i = IndexLookup.Data[c];
-    if (i == (ImWchar)-1)
-        return FallbackGlyph;
+    const ImWchar i = GetIndexLookup(c); // IM_FONTGLYPH_INDEX_UNUSED when 'c' is out of IndexPageMap[] range
+    if (i >= IM_FONTGLYPH_INDEX_NOT_LOADED)
+    {
+        const ImFontGlyph* glyph = (i == IM_FONTGLYPH_INDEX_NOT_LOADED) ? const_cast<ImFont*>(this)->LoadGlyph(c) : NULL;
+        return glyph ? glyph : FallbackGlyph;
+    }
     return &Glyphs.Data[i];
 }
 
 const ImFontGlyph* ImFont::FindGlyphNoFallback(ImWchar c) const
 {
-    if (c >= (size_t)IndexLookup.Size)
-        return NULL;
-    const ImWchar i = IndexLookup.Data[c];
-    if (i == (ImWchar)-1)
-        return NULL;
+    const ImWchar i = GetIndexLookup(c);
+    if (i >= IM_FONTGLYPH_INDEX_NOT_LOADED)
+        return (i == IM_FONTGLYPH_INDEX_NOT_LOADED) ? const_cast<ImFont*>(this)->LoadGlyph(c) : NULL;
     return &Glyphs.Data[i];
 }
 
@@ -3471,7 +5606,9 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
             }
         }
 
-        const float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : FallbackAdvanceX);
+        float char_width = GetIndexAdvanceX(c);
+        if (char_width < 0.0f)
+            char_width = GetCharAdvance((ImWchar)c); // Not rasterized yet (ImFontAtlasFlags_DynamicGlyphs)
         if (ImCharIsBlankW(c))
         {
             if (inside_word)
@@ -3555,6 +5692,22 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
             }
         }
 
+        // Fast path for runs of 0x20..0x7F characters: no UTF-8 decoding, no control characters, no lookup bounds checks.
+        if (AsciiFastPath && (unsigned char)(*s - 0x20) < 0x60)
+        {
+            const char* run_end = ImTextFindEndOfAsciiRun(s, word_wrap_enabled ? word_wrap_eol : text_end);
+            for (; s < run_end; s++)
+            {
+                const float char_width = AsciiAdvanceX[(unsigned char)*s] * scale;
+                if (line_width + char_width >= max_width)
+                    break;
+                line_width += char_width;
+            }
+            if (s < run_end)
+                break;
+            continue;
+        }
+
         // Decode and advance source
         const char* prev_s = s;
         unsigned int c = (unsigned int)*s;
@@ -3576,7 +5729,10 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
                 continue;
         }
 
-        const float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : FallbackAdvanceX) * scale;
+        float char_width = GetIndexAdvanceX(c);
+        if (char_width < 0.0f)
+            char_width = GetCharAdvance((ImWchar)c); // Not rasterized yet (ImFontAtlasFlags_DynamicGlyphs)
+        char_width *= scale;
         if (line_width + char_width >= max_width)
         {
             s = prev_s;
@@ -3598,6 +5754,92 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
     return text_size;
 }
 
+//-----------------------------------------------------------------------------
+// ImGuiTextWrapLayout
+//-----------------------------------------------------------------------------
+
+bool ImGuiTextWrapLayout::Update(ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end)
+{
+    const int text_len = (int)(text_end - text);
+    const ImGuiID text_hash = ImHashData(text, (size_t)text_len);
+    if (Font == font && FontVersion == font->LookupTablesVersion && FontSize == font_size && WrapWidth == wrap_width && TextLen == text_len && TextHash == text_hash)
+        return false;
+    Build(font, font_size, wrap_width, text, text_end);
+    TextLen = text_len;
+    TextHash = text_hash;
+    return true;
+}
+
+// Same logic as ImFont::CalcTextSizeA() with word-wrapping, recording lines.
+void ImGuiTextWrapLayout::Build(ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end)
+{
+    IM_ASSERT(wrap_width > 0.0f);
+    Font = font;
+    FontVersion = font->LookupTablesVersion;
+    FontSize = font_size;
+    WrapWidth = wrap_width;
+    Lines.resize(0);
+    Size = ImVec2(0.0f, 0.0f);
+
+    const float scale = font_size / font->FontSize;
+    float line_width = 0.0f;
+    const char* line_begin = text;
+    const char* word_wrap_eol = NULL;
+    const char* s = text;
+    while (s < text_end)
+    {
+        if (!word_wrap_eol)
+            word_wrap_eol = font->CalcWordWrapPositionA(scale, s, text_end, wrap_width - line_width);
+
+        if (s >= word_wrap_eol)
+        {
+            ImGuiTextWrapLine line = { (int)(line_begin - text), (int)(s - text) };
+            Lines.push_back(line);
+            Size.x = ImMax(Size.x, line_width);
+            Size.y += font_size;
+            line_width = 0.0f;
+            word_wrap_eol = NULL;
+            s = line_begin = CalcWordWrapNextLineStartA(s, text_end); // Wrapping skips upcoming blanks
+            continue;
+        }
+
+        // Decode and advance source
+        const char* prev_s = s;
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+            s += 1;
+        else
+            s += ImTextCharFromUtf8(&c, s, text_end);
+
+        if (c < 32)
+        {
+            if (c == '\n')
+            {
+                ImGuiTextWrapLine line = { (int)(line_begin - text), (int)(prev_s - text) };
+                Lines.push_back(line);
+                Size.x = ImMax(Size.x, line_width);
+                Size.y += font_size;
+                line_width = 0.0f;
+                line_begin = s;
+                continue;
+            }
+            if (c == '\r')
+                continue;
+        }
+        line_width += font->GetCharAdvance((ImWchar)c) * scale;
+    }
+
+    // Last line is only accounted in height when not empty
+    Size.x = ImMax(Size.x, line_width);
+    if (line_width > 0.0f || Size.y == 0.0f)
+        Size.y += font_size;
+    if (line_begin < text_end)
+    {
+        ImGuiTextWrapLine line = { (int)(line_begin - text), (int)(text_end - text) };
+        Lines.push_back(line);
+    }
+}
+
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
 void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, ImWchar c) const
 {
@@ -3609,8 +5851,23 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     float scale = (size >= 0.0f) ? (size / FontSize) : 1.0f;
     float x = IM_FLOOR(pos.x);
     float y = IM_FLOOR(pos.y);
+    if (glyph->TexPage != 0)
+        draw_list->PushTextureID(ContainerAtlas->GetTexPageID(glyph->TexPage));
     draw_list->PrimReserve(6, 4);
     draw_list->PrimRectUV(ImVec2(x + glyph->X0 * scale, y + glyph->Y0 * scale), ImVec2(x + glyph->X1 * scale, y + glyph->Y1 * scale), ImVec2(glyph->U0, glyph->V0), ImVec2(glyph->U1, glyph->V1), col);
+    if (glyph->TexPage != 0)
+        draw_list->PopTextureID();
+}
+
+// Give back unused vertices (clipped ones, blanks) ~ this is essentially a PrimUnreserve() action.
+static inline void ImFontRenderTextUnreserve(ImDrawList* draw_list, ImDrawVert* vtx_write, ImDrawIdx* idx_write, unsigned int vtx_index, int idx_expected_size)
+{
+    draw_list->VtxBuffer.Size = (int)(vtx_write - draw_list->VtxBuffer.Data); // Same as calling shrink()
+    draw_list->IdxBuffer.Size = (int)(idx_write - draw_list->IdxBuffer.Data);
+    draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount -= (idx_expected_size - draw_list->IdxBuffer.Size);
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxCurrentIdx = vtx_index;
 }
 
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
@@ -3671,14 +5928,16 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     // Reserve vertices for remaining worse case (over-reserving is useful and easily amortized)
     const int vtx_count_max = (int)(text_end - s) * 4;
     const int idx_count_max = (int)(text_end - s) * 6;
-    const int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
+    int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
     draw_list->PrimReserve(idx_count_max, vtx_count_max);
     ImDrawVert*  vtx_write = draw_list->_VtxWritePtr;
     ImDrawIdx*   idx_write = draw_list->_IdxWritePtr;
     unsigned int vtx_index = draw_list->_VtxCurrentIdx;
+    unsigned int tex_page = 0; // Texture page of the current draw command, see ImFontAtlas::TexMaxHeight. Page 0 is the texture bound by the caller.
 
     const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
     const char* word_wrap_eol = NULL;
+    const char* ascii_run_end = s; // All bytes in [s, ascii_run_end) are in 0x20..0x7F range
 
     while (s < text_end)
     {
@@ -3698,31 +5957,43 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
             }
         }
 
-        // Decode and advance source
-        unsigned int c = (unsigned int)*s;
-        if (c < 0x80)
+        // Fast path for runs of 0x20..0x7F characters: no UTF-8 decoding, no control characters, no lookup bounds checks.
+        if (s >= ascii_run_end && AsciiFastPath)
+            ascii_run_end = ImTextFindEndOfAsciiRun(s, text_end);
+        const ImFontGlyph* glyph;
+        if (s < ascii_run_end)
+        {
+            glyph = &Glyphs.Data[AsciiGlyphIndex[(unsigned char)*s]];
             s += 1;
+        }
         else
-            s += ImTextCharFromUtf8(&c, s, text_end);
-
-        if (c < 32)
         {
-            if (c == '\n')
+            // Decode and advance source
+            unsigned int c = (unsigned int)*s;
+            if (c < 0x80)
+                s += 1;
+            else
+                s += ImTextCharFromUtf8(&c, s, text_end);
+
+            if (c < 32)
             {
-                x = start_x;
-                y += line_height;
-                if (y > clip_rect.w)
-                    break; // break out of main loop
-                continue;
+                if (c == '\n')
+                {
+                    x = start_x;
+                    y += line_height;
+                    if (y > clip_rect.w)
+                        break; // break out of main loop
+                    continue;
+                }
+                if (c == '\r')
+                    continue;
             }
-            if (c == '\r')
+
+            glyph = FindGlyph((ImWchar)c);
+            if (glyph == NULL)
                 continue;
         }
 
-        const ImFontGlyph* glyph = FindGlyph((ImWchar)c);
-        if (glyph == NULL)
-            continue;
-
         float char_width = glyph->AdvanceX * scale;
         if (glyph->Visible)
         {
@@ -3733,6 +6004,23 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
             float y2 = y + glyph->Y1 * scale;
             if (x1 <= clip_rect.z && x2 >= clip_rect.x)
             {
+                // Glyph from another texture page: finish current draw command and reserve again for the remaining worse case
+                if (glyph->TexPage != tex_page)
+                {
+                    ImFontRenderTextUnreserve(draw_list, vtx_write, idx_write, vtx_index, idx_expected_size);
+                    if (tex_page != 0)
+                        draw_list->PopTextureID();
+                    tex_page = glyph->TexPage;
+                    if (tex_page != 0)
+                        draw_list->PushTextureID(ContainerAtlas->GetTexPageID((int)tex_page));
+                    const int chars_left = (int)(text_end - s) + 1;
+                    idx_expected_size = draw_list->IdxBuffer.Size + chars_left * 6;
+                    draw_list->PrimReserve(chars_left * 6, chars_left * 4);
+                    vtx_write = draw_list->_VtxWritePtr;
+                    idx_write = draw_list->_IdxWritePtr;
+                    vtx_index = draw_list->_VtxCurrentIdx;
+                }
+
                 // Render a character
                 float u1 = glyph->U0;
                 float v1 = glyph->V0;
@@ -3789,13 +6077,9 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
         x += char_width;
     }
 
-    // Give back unused vertices (clipped ones, blanks) ~ this is essentially a PrimUnreserve() action.
-    draw_list->VtxBuffer.Size = (int)(vtx_write - draw_list->VtxBuffer.Data); // Same as calling shrink()
-    draw_list->IdxBuffer.Size = (int)(idx_write - draw_list->IdxBuffer.Data);
-    draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount -= (idx_expected_size - draw_list->IdxBuffer.Size);
-    draw_list->_VtxWritePtr = vtx_write;
-    draw_list->_IdxWritePtr = idx_write;
-    draw_list->_VtxCurrentIdx = vtx_index;
+    ImFontRenderTextUnreserve(draw_list, vtx_write, idx_write, vtx_index, idx_expected_size);
+    if (tex_page != 0)
+        draw_list->PopTextureID();
 }
 
 //-----------------------------------------------------------------------------
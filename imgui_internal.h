@@ -122,7 +122,9 @@ Index of this file:
 struct ImBitVector;                 // Store 1-bit per value
 struct ImRect;                      // An axis-aligned rectangle (2 points)
 struct ImDrawDataBuilder;           // Helper to build a ImDrawData instance
+struct ImDrawDataDirtyTracker;      // Storage to compute ImDrawData::DirtyRects and ImDrawData::Unchanged between frames
 struct ImDrawListSharedData;        // Data shared between all ImDrawList instances
+struct ImFontAtlasRectPacker;       // Rectangle packer used by font atlas builders (stb_rectpack skyline, or shelves with ImFontAtlasFlags_PackShelves)
 struct ImGuiColorMod;               // Stacked color modifier, backup of modified data so we can restore it
 struct ImGuiContext;                // Main Dear ImGui context
 struct ImGuiContextHook;            // Hook for extensions like ImGuiTestEngine
@@ -333,6 +335,7 @@ namespace ImStb
 // Helpers: Hashing
 IMGUI_API ImGuiID       ImHashData(const void* data, size_t data_size, ImGuiID seed = 0);
 IMGUI_API ImGuiID       ImHashStr(const char* data, size_t data_size = 0, ImGuiID seed = 0);
+IMGUI_API ImU64         ImHashData64(const void* data, size_t data_size, ImU64 seed = 0);
 
 // Helpers: Sorting
 #ifndef ImQsort
@@ -386,6 +389,7 @@ IMGUI_API int           ImTextStrFromUtf8(ImWchar* out_buf, int out_buf_size, co
 IMGUI_API int           ImTextCountCharsFromUtf8(const char* in_text, const char* in_text_end);                                 // return number of UTF-8 code-points (NOT bytes count)
 IMGUI_API int           ImTextCountUtf8BytesFromChar(const char* in_text, const char* in_text_end);                             // return number of bytes to express one char in UTF-8
 IMGUI_API int           ImTextCountUtf8BytesFromStr(const ImWchar* in_text, const ImWchar* in_text_end);                        // return number of bytes to express string in UTF-8
+IMGUI_API const char*   ImTextFindEndOfAsciiRun(const char* in_text, const char* in_text_end);                                  // return first byte outside of 0x20..0x7F range (no UTF-8 decoding nor control character needed before it)
 
 // Helpers: File System
 #ifdef IMGUI_DISABLE_FILE_FUNCTIONS
@@ -408,6 +412,11 @@ IMGUI_API ImU64             ImFileWrite(const void* data, ImU64 size, ImU64 coun
 #define IMGUI_DISABLE_TTY_FUNCTIONS // Can't use stdout, fflush if we are not using default file functions
 #endif
 IMGUI_API void*             ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_file_size = NULL, int padding_bytes = 0);
+typedef void* ImFileMapHandle;
+IMGUI_API ImFileMapHandle   ImFileMapOpen(const char* filename);                                // Open file for mapping. Return NULL if unsupported (see IMGUI_DISABLE_FILE_MAPPING) or failed: use ImFileLoadToMemory() instead.
+IMGUI_API void              ImFileMapClose(ImFileMapHandle file);
+IMGUI_API void*             ImFileMapToMemory(ImFileMapHandle file, size_t* out_file_size);     // Map whole file read-only. May be called again while the file is open, even if it was renamed or deleted.
+IMGUI_API void              ImFileUnmapFromMemory(void* data, size_t data_size);
 
 // Helpers: Maths
 IM_MSVC_RUNTIME_CHECKS_OFF
@@ -717,6 +726,33 @@ struct ImGuiTextIndex
     void            append(const char* base, int old_size, int new_size);
 };
 
+// Helper: ImGuiTextWrapLayout
+// Store lines of a word-wrapped text block, so they are only recomputed when text, font, font size or wrap width changed.
+// Lines and size match what ImFont::CalcTextSizeA() computes with word-wrapping. Used by TextWrapped() to only render visible lines of large text blocks.
+#define IMGUI_TEXT_WRAP_LAYOUT_MIN_LENGTH   2000    // Wrapped text blocks longer than this (in bytes) have their lines stored in ImGuiWindow::TextWrapLayouts
+struct ImGuiTextWrapLine
+{
+    int             Begin;                                  // Offset of first character
+    int             End;                                    // Offset after last character (blanks skipped by wrapping and line feeds are excluded)
+};
+
+struct ImGuiTextWrapLayout
+{
+    ImGuiID         ID = 0;                                 // Call site: hash of submission order within window and ID stack top
+    ImVector<ImGuiTextWrapLine> Lines;
+    ImVec2          Size = ImVec2(0.0f, 0.0f);              // Same as ImFont::CalcTextSizeA() (not rounded)
+    ImFont*         Font = NULL;                            // Inputs of last Build()
+    ImU32           FontVersion = 0;                        // ImFont::LookupTablesVersion
+    float           FontSize = 0.0f;
+    float           WrapWidth = 0.0f;
+    int             TextLen = 0;
+    ImGuiID         TextHash = 0;
+    int             LastUsedFrame = -1;                     // For garbage collection of layouts stored in ImGuiContext
+
+    IMGUI_API bool  Update(ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end); // Rebuild if any input changed. Return true when rebuilt.
+    IMGUI_API void  Build(ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end);
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImDrawList support
 //-----------------------------------------------------------------------------
@@ -766,6 +802,7 @@ struct IMGUI_API ImDrawListSharedData
     float           ArcFastRadiusCutoff;                        // Cutoff radius after which arc drawing will fallback to slower PathArcTo()
     ImU8            CircleSegmentCounts[64];    // Precomputed segment count for given radius before we calculate it dynamically (to avoid calculation overhead)
     const ImVec4*   TexUvLines;                 // UV of anti-aliased lines in the atlas
+    const ImVec4*   TexUvRoundCorners;          // UV of anti-aliased quarter discs in the atlas
 
     ImDrawListSharedData();
     void SetCircleTessellationMaxError(float max_error);
@@ -779,6 +816,37 @@ struct ImDrawDataBuilder
     ImDrawDataBuilder()                     { memset(this, 0, sizeof(*this)); }
 };
 
+// Contents of a draw list, as recorded to compare with the next frame
+struct ImDrawListHashEntry
+{
+    const ImDrawList*   DrawList;           // Draw list, its buffers and sizes: a list with the same values and ResetStamp wasn't modified since, its hash and bounds are reused
+    const ImDrawVert*   VtxData;
+    unsigned int        ResetStamp;         // ImDrawList::_ResetStamp, 0 = never reused
+    int                 CmdCount, IdxCount, VtxCount, ShapeCount;
+    ImU64               ContentHash;        // Hash of the draw list buffers, 0 if not computed
+    ImU64               Hash;               // ContentHash combined with ContentHash of the draw lists below which overlap Bounds (dirty rectangles only)
+    ImRect              Bounds;             // Screen bounds of the draw list output (dirty rectangles only)
+    bool                HasBounds;
+    bool                AlwaysDirty;        // Draw list has user callbacks, which may render anything
+};
+
+// Storage to compute ImDrawData::DirtyRects and ImDrawData::Unchanged, comparing draw lists with the previous frame (io.ConfigDrawDataDirtyRects, io.ConfigDrawDataFingerprint)
+struct ImDrawDataDirtyTracker
+{
+    ImVector<ImDrawListHashEntry> Entries;  // Draw lists of the current frame, in display order
+    ImVector<ImDrawListHashEntry> PrevEntries; // Draw lists of the previous update
+    int         EntriesFrame;               // Frame number of Entries[] and PrevEntries[]
+    int         PrevEntriesFrame;
+    int         LastFrame;                  // Frame number of the previous dirty rectangles update, other values require a full redraw
+    ImVec2      DisplayPos;                 // Display of the previous update, changes require a full redraw
+    ImVec2      DisplaySize;
+    ImVec2      FramebufferScale;
+    ImU64       Fingerprint;                // ImDrawData::Fingerprint of the previous update (io.ConfigDrawDataFingerprint), 0 if not computed
+    int         FingerprintLastFrame;
+
+    ImDrawDataDirtyTracker()                { EntriesFrame = PrevEntriesFrame = LastFrame = FingerprintLastFrame = -1; Fingerprint = 0; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Widgets support: flags, enums, data structures
 //-----------------------------------------------------------------------------
@@ -1253,6 +1321,29 @@ struct ImGuiPtrOrIndex
     ImGuiPtrOrIndex(int index)  { Ptr = NULL; Index = index; }
 };
 
+// Cached result of CalcTextSize() (io.ConfigTextSizeCache)
+struct ImGuiTextSizeCacheEntry
+{
+    ImU64       Key;            // 64-bit hash of font, font size, wrap width and text. 0 = unused.
+    int         TextLen;
+    int         LastUsedFrame;  // Least recently used entry of a set gets evicted first
+    ImVec2      Size;
+};
+
+// 2-way set associative cache of CalcTextSize() results. Grown at the beginning of a frame when more than 1/32 of lookups during the previous frame evicted an entry used in the same frame.
+struct ImGuiTextSizeCache
+{
+    ImVector<ImGuiTextSizeCacheEntry> Entries;  // Set N uses Entries[N*2] and Entries[N*2+1]
+    int         HitsCount;                      // Current frame
+    int         MissesCount;
+    int         EvictionsCount;                 // Entries used during current frame which got evicted
+    int         HitsCountLastFrame;
+    int         MissesCountLastFrame;
+    int         EvictionsCountLastFrame;
+
+    ImGuiTextSizeCache()        { HitsCount = MissesCount = EvictionsCount = HitsCountLastFrame = MissesCountLastFrame = EvictionsCountLastFrame = 0; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Inputs support
 //-----------------------------------------------------------------------------
@@ -1615,13 +1706,15 @@ struct ImGuiViewportP : public ImGuiViewport
     ImDrawList*         BgFgDrawLists[2];       // Convenience background (0) and foreground (1) draw lists. We use them to draw software mouser cursor when io.MouseDrawCursor is set and to draw most debug overlays.
     ImDrawData          DrawDataP;
     ImDrawDataBuilder   DrawDataBuilder;        // Temporary data while building final ImDrawData
+    ImVector<ImDrawList*> DrawDataMergedLists;  // Draw lists output by MergeDrawDataLists() when io.ConfigDrawDataMergeLists is set. Reused every frame.
+    ImDrawDataDirtyTracker DrawDataDirtyTracker; // Previous frame contents, to compute DrawDataP.DirtyRects when io.ConfigDrawDataDirtyRects is set.
     ImVec2              WorkOffsetMin;          // Work Area: Offset from Pos to top-left corner of Work Area. Generally (0,0) or (0,+main_menu_bar_height). Work Area is Full Area but without menu-bars/status-bars (so WorkArea always fit inside Pos/Size!)
     ImVec2              WorkOffsetMax;          // Work Area: Offset from Pos+Size to bottom-right corner of Work Area. Generally (0,0) or (0,-status_bar_height).
     ImVec2              BuildWorkOffsetMin;     // Work Area: Offset being built during current frame. Generally >= 0.0f.
     ImVec2              BuildWorkOffsetMax;     // Work Area: Offset being built during current frame. Generally <= 0.0f.
 
     ImGuiViewportP()    { BgFgDrawListsLastFrame[0] = BgFgDrawListsLastFrame[1] = -1; BgFgDrawLists[0] = BgFgDrawLists[1] = NULL; }
-    ~ImGuiViewportP()   { if (BgFgDrawLists[0]) IM_DELETE(BgFgDrawLists[0]); if (BgFgDrawLists[1]) IM_DELETE(BgFgDrawLists[1]); }
+    ~ImGuiViewportP()   { if (BgFgDrawLists[0]) IM_DELETE(BgFgDrawLists[0]); if (BgFgDrawLists[1]) IM_DELETE(BgFgDrawLists[1]); for (int n = 0; n < DrawDataMergedLists.Size; n++) IM_DELETE(DrawDataMergedLists[n]); }
 
     // Calculate work rect pos/size given a set of offset (we have 1 pair of offset for rect locked from last frame data, and 1 pair for currently building rect)
     ImVec2  CalcWorkRectPos(const ImVec2& off_min) const                            { return ImVec2(Pos.x + off_min.x, Pos.y + off_min.y); }
@@ -1783,6 +1876,7 @@ struct ImGuiContext
     float                   FontSize;                           // (Shortcut) == FontBaseSize * g.CurrentWindow->FontWindowScale == window->FontSize(). Text height for current window.
     float                   FontBaseSize;                       // (Shortcut) == IO.FontGlobalScale * Font->Scale * Font->FontSize. Base text height.
     ImDrawListSharedData    DrawListSharedData;
+    ImGuiTextSizeCache      TextSizeCache;                      // Results of CalcTextSize() across frames (io.ConfigTextSizeCache)
     double                  Time;
     int                     FrameCount;
     int                     FrameCountEnded;
@@ -1941,6 +2035,8 @@ struct ImGuiContext
 
     // Render
     float                   DimBgRatio;                         // 0.0..1.0 animation when fading in a dimming background (for modal window and CTRL+TAB list)
+    int                     RenderDrawCmdsCount;                // Draw commands output during last call to Render()
+    int                     RenderDrawCmdsCountBeforeMerge;     // Draw commands during last call to Render() before merging draw lists (io.ConfigDrawDataMergeLists)
 
     // Drag and Drop
     bool                    DragDropActive;
@@ -2169,6 +2265,7 @@ struct ImGuiContext
         NavWindowingToggleLayer = false;
 
         DimBgRatio = 0.0f;
+        RenderDrawCmdsCount = RenderDrawCmdsCountBeforeMerge = 0;
 
         DragDropActive = DragDropWithinSource = DragDropWithinTarget = false;
         DragDropSourceFlags = ImGuiDragDropFlags_None;
@@ -2298,6 +2395,7 @@ struct IMGUI_API ImGuiWindowTempData
     float                   TextWrapPos;            // Current text wrap pos.
     ImVector<float>         ItemWidthStack;         // Store item widths to restore (attention: .back() is not == ItemWidth)
     ImVector<float>         TextWrapPosStack;       // Store text wrap pos to restore (attention: .back() is not == TextWrapPos)
+    int                     TextWrapLayoutsCount;   // Number of large wrapped text blocks submitted this frame, see GetTextWrapLayout()
 };
 
 // Storage for one window
@@ -2382,6 +2480,7 @@ struct IMGUI_API ImGuiWindow
     float                   ItemWidthDefault;
     ImGuiStorage            StateStorage;
     ImVector<ImGuiOldColumns> ColumnsStorage;
+    ImVector<ImGuiTextWrapLayout> TextWrapLayouts;              // Lines of large word-wrapped text blocks submitted in this window. Dropped when not used during a frame.
     float                   FontWindowScale;                    // User scale multiplier per-window, via SetWindowFontScale()
     int                     SettingsOffset;                     // Offset into SettingsWindows[] (offsets are always valid as we only grow the array from the back)
 
@@ -2811,11 +2910,17 @@ namespace ImGui
 
     // Fonts, drawing
     IMGUI_API void          SetCurrentFont(ImFont* font);
+    IMGUI_API ImGuiTextSizeCacheEntry* TextSizeCacheLookup(ImU64 key, int text_len);
+    IMGUI_API ImGuiTextWrapLayout* GetTextWrapLayout(const char* text, const char* text_end, float wrap_width);
+    IMGUI_API void          TextSizeCacheResize(ImGuiTextSizeCache* cache, int entries_count);
     inline ImFont*          GetDefaultFont() { ImGuiContext& g = *GImGui; return g.IO.FontDefault ? g.IO.FontDefault : g.IO.Fonts->Fonts[0]; }
     inline ImDrawList*      GetForegroundDrawList(ImGuiWindow* window) { IM_UNUSED(window); return GetForegroundDrawList(); } // This seemingly unnecessary wrapper simplifies compatibility between the 'master' and 'docking' branches.
     IMGUI_API ImDrawList*   GetBackgroundDrawList(ImGuiViewport* viewport);                     // get background draw list for the given viewport. this draw list will be the first rendering one. Useful to quickly draw shapes/text behind dear imgui contents.
     IMGUI_API ImDrawList*   GetForegroundDrawList(ImGuiViewport* viewport);                     // get foreground draw list for the given viewport. this draw list will be the last rendered one. Useful to quickly draw shapes/text over dear imgui contents.
     IMGUI_API void          AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>* out_list, ImDrawList* draw_list);
+    IMGUI_API void          MergeDrawDataLists(ImDrawData* draw_data, ImVector<ImDrawList*>* merged_lists);
+    IMGUI_API void          UpdateDrawDataDirtyRects(ImDrawData* draw_data, ImDrawDataDirtyTracker* tracker, int frame_count);
+    IMGUI_API void          UpdateDrawDataFingerprint(ImDrawData* draw_data, ImDrawDataDirtyTracker* tracker, int frame_count);
 
     // Init
     IMGUI_API void          Initialize();
@@ -2987,6 +3092,7 @@ namespace ImGui
     IMGUI_API ImVec2        GetKeyMagnitude2d(ImGuiKey key_left, ImGuiKey key_right, ImGuiKey key_up, ImGuiKey key_down);
     IMGUI_API float         GetNavTweakPressedAmount(ImGuiAxis axis);
     IMGUI_API int           CalcTypematicRepeatAmount(float t0, float t1, float repeat_delay, float repeat_rate);
+    IMGUI_API float         CalcTypematicRepeatNextDelay(float t, float repeat_delay, float repeat_rate);
     IMGUI_API void          GetTypematicRepeatRate(ImGuiInputFlags flags, float* repeat_delay, float* repeat_rate);
     IMGUI_API void          SetActiveIdUsingAllKeyboardKeys();
     inline bool             IsActiveIdUsingNavDir(ImGuiDir dir)                         { ImGuiContext& g = *GImGui; return (g.ActiveIdUsingNavDirMask & (1 << dir)) != 0; }
@@ -3148,6 +3254,7 @@ namespace ImGui
     // NB: All position are in absolute pixels coordinates (we are never using window coordinates internally)
     IMGUI_API void          RenderText(ImVec2 pos, const char* text, const char* text_end = NULL, bool hide_text_after_hash = true);
     IMGUI_API void          RenderTextWrapped(ImVec2 pos, const char* text, const char* text_end, float wrap_width);
+    IMGUI_API void          RenderTextWrappedLayout(ImVec2 pos, const char* text, const ImGuiTextWrapLayout* layout);
     IMGUI_API void          RenderTextClipped(const ImVec2& pos_min, const ImVec2& pos_max, const char* text, const char* text_end, const ImVec2* text_size_if_known, const ImVec2& align = ImVec2(0, 0), const ImRect* clip_rect = NULL);
     IMGUI_API void          RenderTextClippedEx(ImDrawList* draw_list, const ImVec2& pos_min, const ImVec2& pos_max, const char* text, const char* text_end, const ImVec2* text_size_if_known, const ImVec2& align = ImVec2(0, 0), const ImRect* clip_rect = NULL);
     IMGUI_API void          RenderTextEllipsis(ImDrawList* draw_list, const ImVec2& pos_min, const ImVec2& pos_max, float clip_max_x, float ellipsis_max_x, const char* text, const char* text_end, const ImVec2* text_size_if_known);
@@ -3302,16 +3409,39 @@ namespace ImGui
 struct ImFontBuilderIO
 {
     bool    (*FontBuilder_Build)(ImFontAtlas* atlas);
+    bool    (*FontBuilder_BuildGlyph)(ImFontAtlas* atlas, ImFontConfig* src_cfg, ImWchar codepoint); // Optional: rasterize one glyph after Build() (ImFontAtlasFlags_DynamicGlyphs). Uses data stored in atlas->FontBuilderData.
+    void    (*FontBuilder_Destroy)(ImFontAtlas* atlas);                                             // Optional: release atlas->FontBuilderData.
 };
 
+// With ImFontAtlasFlags_DynamicGlyphs: codepoints up to this value are rasterized by Build(), others on first use.
+#ifndef IM_FONTATLAS_DYNAMIC_GLYPHS_PRELOAD_MAX
+#define IM_FONTATLAS_DYNAMIC_GLYPHS_PRELOAD_MAX     0xFF
+#endif
+
+// Special values stored in ImFontIndexPage::Lookup[]
+#define IM_FONTGLYPH_INDEX_UNUSED                   ((ImWchar)-1)   // No glyph for this codepoint
+#define IM_FONTGLYPH_INDEX_NOT_LOADED               ((ImWchar)-2)   // Glyph available from the font sources but not rasterized yet (ImFontAtlasFlags_DynamicGlyphs)
+
 // Helper for font builder
 #ifdef IMGUI_ENABLE_STB_TRUETYPE
 IMGUI_API const ImFontBuilderIO* ImFontAtlasGetBuilderForStbTruetype();
 #endif
 IMGUI_API void      ImFontAtlasBuildInit(ImFontAtlas* atlas);
 IMGUI_API void      ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent);
-IMGUI_API void      ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opaque);
+IMGUI_API ImFontAtlasRectPacker* ImFontAtlasBuildPackBegin(ImFontAtlas* atlas, int width, int height);
+IMGUI_API void      ImFontAtlasBuildPackRects(ImFontAtlasRectPacker* packer, void* stbrp_rects_opaque, int rects_count);
+IMGUI_API void      ImFontAtlasBuildPackEnd(ImFontAtlasRectPacker* packer);
+IMGUI_API void      ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, ImFontAtlasRectPacker* packer);
+IMGUI_API int       ImFontAtlasBuildPackExtraPages(ImFontAtlas* atlas, void* stbrp_rects_opaque, int rects_count);
+IMGUI_API void      ImFontAtlasBuildAllocExtraPages(ImFontAtlas* atlas);
 IMGUI_API void      ImFontAtlasBuildFinish(ImFontAtlas* atlas);
+IMGUI_API void      ImFontAtlasBuildParallelFor(ImFontAtlas* atlas, void (*job_func)(void* job_data, int job_index), void* job_data, int job_count);
+IMGUI_API void      ImFontAtlasBuildReserveDynamicSpace(ImFontAtlas* atlas);
+IMGUI_API bool      ImFontAtlasBuildAllocDynamicRect(ImFontAtlas* atlas, int w, int h, int* out_x, int* out_y);
+IMGUI_API void      ImFontAtlasBuildUpdateTexRect(ImFontAtlas* atlas, int x, int y, int w, int h);
+IMGUI_API void      ImFontAtlasBuildClearDynamicData(ImFontAtlas* atlas);
+IMGUI_API bool      ImFontAtlasBuildMapFontData(ImFontAtlas* atlas);
+IMGUI_API void      ImFontAtlasBuildReleaseFontData(ImFontAtlas* atlas);
 IMGUI_API void      ImFontAtlasBuildRender8bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned char in_marker_pixel_value);
 IMGUI_API void      ImFontAtlasBuildRender32bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned int in_marker_pixel_value);
 IMGUI_API void      ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
@@ -1226,6 +1226,8 @@ void ImGui::TableUpdateBorders(ImGuiTable* table)
             table->ResizedColumn = (ImGuiTableColumnIdx)column_n;
             table->InstanceInteracted = table->InstanceCurrent;
         }
+        if (hovered && g.HoveredIdTimer <= TABLE_RESIZE_SEPARATOR_FEEDBACK_TIMER)
+            RequestNextFrame(TABLE_RESIZE_SEPARATOR_FEEDBACK_TIMER - g.HoveredIdTimer);
         if ((hovered && g.HoveredIdTimer > TABLE_RESIZE_SEPARATOR_FEEDBACK_TIMER) || held)
         {
             table->HoveredColumnBorder = (ImGuiTableColumnIdx)column_n;
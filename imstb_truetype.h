@@ -1124,6 +1124,11 @@ typedef int stbtt__test_oversample_pow2[(STBTT_MAX_OVERSAMPLE & (STBTT_MAX_OVERS
 #define STBTT_RASTERIZER_VERSION 2
 #endif
 
+// [DEAR IMGUI] Added STBTT_SSE2 to use SSE2 intrinsics in the rasterizer accumulation pass and the oversampling prefilters
+#ifdef STBTT_SSE2
+#include <emmintrin.h>
+#endif
+
 #ifdef _MSC_VER
 #define STBTT__NOTUSED(v)  (void)(v)
 #else
@@ -3370,7 +3375,34 @@ static void stbtt__rasterize_sorted_edges(stbtt__bitmap *result, stbtt__edge *e,
 
       {
          float sum = 0;
-         for (i=0; i < result->w; ++i) {
+         i = 0;
+#ifdef STBTT_SSE2
+         // [DEAR IMGUI] Process 4 pixels at a time, with an in-register prefix sum for the running sum. Output matches the scalar path on all glyphs of misc/fonts.
+         {
+            const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+            const __m128 v255 = _mm_set1_ps(255.0f);
+            const __m128 vhalf = _mm_set1_ps(0.5f);
+            __m128 vsum = _mm_setzero_ps();
+            for (; i + 4 <= result->w; i += 4) {
+               __m128 s2 = _mm_loadu_ps(scanline2 + i);
+               __m128 k;
+               __m128i m;
+               int m4;
+               s2 = _mm_add_ps(s2, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(s2), 4)));
+               s2 = _mm_add_ps(s2, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(s2), 8)));
+               s2 = _mm_add_ps(s2, vsum);
+               vsum = _mm_shuffle_ps(s2, s2, _MM_SHUFFLE(3, 3, 3, 3));
+               k = _mm_add_ps(_mm_loadu_ps(scanline + i), s2);
+               k = _mm_add_ps(_mm_mul_ps(_mm_and_ps(k, abs_mask), v255), vhalf);
+               m = _mm_cvttps_epi32(_mm_min_ps(k, v255));
+               m = _mm_packs_epi32(m, m);
+               m4 = _mm_cvtsi128_si32(_mm_packus_epi16(m, m));
+               STBTT_memcpy(result->pixels + j*result->stride + i, &m4, 4);
+            }
+            sum = _mm_cvtss_f32(vsum);
+         }
+#endif
+         for (; i < result->w; ++i) {
             float k;
             int m;
             sum += scanline2[i];
@@ -4017,8 +4049,42 @@ STBTT_DEF void stbtt_PackSetSkipMissingCodepoints(stbtt_pack_context *spc, int s
 
 #define STBTT__OVER_MASK  (STBTT_MAX_OVERSAMPLE-1)
 
+#if defined(STBTT_SSE2) && STBTT_MAX_OVERSAMPLE <= 16
+// [DEAR IMGUI] Divide 16-bit sums of up to kernel_width pixels by kernel_width (2 to 16) with a multiply, exact in this range.
+static __m128i stbtt__div_kernel_epu16(__m128i total, unsigned int kernel_width)
+{
+   return _mm_mulhi_epu16(total, _mm_set1_epi16((short)((65536 + kernel_width - 1) / kernel_width)));
+}
+#endif
+
 static void stbtt__h_prefilter(unsigned char *pixels, int w, int h, int stride_in_bytes, unsigned int kernel_width)
 {
+#if defined(STBTT_SSE2) && STBTT_MAX_OVERSAMPLE <= 16
+   // [DEAR IMGUI] Each output pixel is the average of the kernel_width input pixels ending at it. Process 16 pixels at a time
+   // from right to left so the inputs on the left are read before being overwritten. Output is identical to the scalar path.
+   const __m128i zero = _mm_setzero_si128();
+   int j;
+   for (j=0; j < h; ++j) {
+      int i, x;
+      for (x = w - 16; x >= (int)kernel_width - 1; x -= 16) {
+         __m128i total_lo = zero, total_hi = zero, v;
+         unsigned int t;
+         for (t=0; t < kernel_width; ++t) {
+            v = _mm_loadu_si128((const __m128i *)(const void *)(pixels + x - t));
+            total_lo = _mm_add_epi16(total_lo, _mm_unpacklo_epi8(v, zero));
+            total_hi = _mm_add_epi16(total_hi, _mm_unpackhi_epi8(v, zero));
+         }
+         _mm_storeu_si128((__m128i *)(void *)(pixels + x), _mm_packus_epi16(stbtt__div_kernel_epu16(total_lo, kernel_width), stbtt__div_kernel_epu16(total_hi, kernel_width)));
+      }
+      for (i = x + 15; i >= 0; --i) {
+         unsigned int total = 0, t;
+         for (t=0; t < kernel_width && t <= (unsigned int)i; ++t)
+            total += pixels[i - t];
+         pixels[i] = (unsigned char) (total / kernel_width);
+      }
+      pixels += stride_in_bytes;
+   }
+#else
    unsigned char buffer[STBTT_MAX_OVERSAMPLE];
    int safe_w = w - kernel_width;
    int j;
@@ -4077,6 +4143,7 @@ static void stbtt__h_prefilter(unsigned char *pixels, int w, int h, int stride_i
 
       pixels += stride_in_bytes;
    }
+#endif
 }
 
 static void stbtt__v_prefilter(unsigned char *pixels, int w, int h, int stride_in_bytes, unsigned int kernel_width)
@@ -4084,6 +4151,28 @@ static void stbtt__v_prefilter(unsigned char *pixels, int w, int h, int stride_i
    unsigned char buffer[STBTT_MAX_OVERSAMPLE];
    int safe_h = h - kernel_width;
    int j;
+#if defined(STBTT_SSE2) && STBTT_MAX_OVERSAMPLE <= 16
+   // [DEAR IMGUI] Same running total as the scalar path below, for 16 columns at a time. Remaining columns use the scalar path.
+   {
+      const __m128i zero = _mm_setzero_si128();
+      __m128i rows[STBTT_MAX_OVERSAMPLE];
+      for (; w >= 16; w -= 16) {
+         __m128i total_lo = zero, total_hi = zero;
+         int i;
+         for (i=0; i < STBTT_MAX_OVERSAMPLE; ++i)
+            rows[i] = zero;
+         for (i=0; i < h; ++i) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(const void *)(pixels + i*stride_in_bytes));
+            __m128i old = rows[i & STBTT__OVER_MASK];
+            rows[(i+kernel_width) & STBTT__OVER_MASK] = v;
+            total_lo = _mm_sub_epi16(_mm_add_epi16(total_lo, _mm_unpacklo_epi8(v, zero)), _mm_unpacklo_epi8(old, zero));
+            total_hi = _mm_sub_epi16(_mm_add_epi16(total_hi, _mm_unpackhi_epi8(v, zero)), _mm_unpackhi_epi8(old, zero));
+            _mm_storeu_si128((__m128i *)(void *)(pixels + i*stride_in_bytes), _mm_packus_epi16(stbtt__div_kernel_epu16(total_lo, kernel_width), stbtt__div_kernel_epu16(total_hi, kernel_width)));
+         }
+         pixels += 16;
+      }
+   }
+#endif
    STBTT_memset(buffer, 0, STBTT_MAX_OVERSAMPLE); // suppress bogus warning from VS2013 -analyze
    for (j=0; j < w; ++j) {
       int i;
@@ -71,8 +71,10 @@
 //-------------------------------------------------------------------------
 
 // Default memory allocators
-static void* ImGuiFreeTypeDefaultAllocFunc(size_t size, void* user_data) { IM_UNUSED(user_data); return IM_ALLOC(size); }
-static void  ImGuiFreeTypeDefaultFreeFunc(void* ptr, void* user_data) { IM_UNUSED(user_data); IM_FREE(ptr); }
+// (FreeType may allocate from worker threads during the atlas build, see ImFontAtlas::BuildParallelForFunc. Call Dear ImGui allocators directly,
+// as IM_ALLOC()/IM_FREE() also update io.MetricsActiveAllocations which is not thread-safe.)
+static void* ImGuiFreeTypeDefaultAllocFunc(size_t size, void* user_data) { IM_UNUSED(user_data); ImGuiMemAllocFunc alloc_func; ImGuiMemFreeFunc free_func; void* alloc_user_data; ImGui::GetAllocatorFunctions(&alloc_func, &free_func, &alloc_user_data); return alloc_func(size, alloc_user_data); }
+static void  ImGuiFreeTypeDefaultFreeFunc(void* ptr, void* user_data) { IM_UNUSED(user_data); ImGuiMemAllocFunc alloc_func; ImGuiMemFreeFunc free_func; void* alloc_user_data; ImGui::GetAllocatorFunctions(&alloc_func, &free_func, &alloc_user_data); free_func(ptr, alloc_user_data); }
 
 // Current memory allocators
 static void* (*GImGuiFreeTypeAllocFunc)(size_t size, void* user_data) = ImGuiFreeTypeDefaultAllocFunc;
@@ -396,7 +398,7 @@ struct ImFontBuildSrcGlyphFT
 {
     GlyphInfo           Info;
     uint32_t            Codepoint;
-    unsigned int*       BitmapData;         // Point within one of the dst_tmp_bitmap_buffers[] array
+    unsigned int*       BitmapData;         // Rasterized pixels, allocated with GImGuiFreeTypeAllocFunc()
 
     ImFontBuildSrcGlyphFT() { memset((void*)this, 0, sizeof(*this)); }
 };
@@ -422,7 +424,90 @@ struct ImFontBuildDstDataFT
     ImBitVector         GlyphsSet;          // This is used to resolve collision when multiple sources are merged into a same destination font.
 };
 
-bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, unsigned int extra_flags)
+// Data shared by all jobs of a build step (one job per source font, as a FT_Face can only be used by one thread at a time)
+struct ImFontBuildJobsDataFT
+{
+    ImFontAtlas*            Atlas;
+    ImFontBuildSrcDataFT*   SrcTmpArray;
+    int                     CodepointMax;       // Step 2: highest codepoint to look up
+};
+
+// Build step 2 job, for source font 'job_index': look up which requested codepoints are available in the font data.
+static void ImFontAtlasBuildJobFindGlyphsFT(void* job_data, int job_index)
+{
+    ImFontBuildJobsDataFT* data = (ImFontBuildJobsDataFT*)job_data;
+    ImFontBuildSrcDataFT& src_tmp = data->SrcTmpArray[job_index];
+    if (data->Atlas->ConfigData[job_index].Deferred && (data->Atlas->Flags & ImFontAtlasFlags_DynamicGlyphs))
+        return; // Rasterized on first use by ImFont::LoadDeferredGlyphs()
+    for (const ImWchar* src_range = src_tmp.SrcRanges; src_range[0] && src_range[1]; src_range += 2)
+        for (int codepoint = src_range[0]; codepoint <= (int)src_range[1] && codepoint <= data->CodepointMax; codepoint++)
+            if (FT_Get_Char_Index(src_tmp.Font.Face, codepoint) != 0) // FIXME-OPT: We are not storing the glyph_index..
+                src_tmp.GlyphsSet.SetBit(codepoint);
+}
+
+// Build step 4 job, for source font 'job_index': rasterize glyphs into temporary buffers and gather their sizes so we can pack them.
+static void ImFontAtlasBuildJobRenderGlyphsFT(void* job_data, int job_index)
+{
+    ImFontBuildJobsDataFT* data = (ImFontBuildJobsDataFT*)job_data;
+    ImFontBuildSrcDataFT& src_tmp = data->SrcTmpArray[job_index];
+    const ImFontConfig& cfg = data->Atlas->ConfigData[job_index];
+
+    // Compute multiply table if requested
+    const bool multiply_enabled = (cfg.RasterizerMultiply != 1.0f);
+    unsigned char multiply_table[256];
+    if (multiply_enabled)
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+
+    const int padding = data->Atlas->TexGlyphPadding;
+    for (int glyph_i = 0; glyph_i < src_tmp.GlyphsList.Size; glyph_i++)
+    {
+        ImFontBuildSrcGlyphFT& src_glyph = src_tmp.GlyphsList[glyph_i];
+
+        const FT_Glyph_Metrics* metrics = src_tmp.Font.LoadGlyph(src_glyph.Codepoint);
+        if (metrics == nullptr)
+            continue;
+
+        // Render glyph into a bitmap (currently held by FreeType)
+        const FT_Bitmap* ft_bitmap = src_tmp.Font.RenderGlyphAndGetInfo(&src_glyph.Info);
+        if (ft_bitmap == nullptr)
+            continue;
+
+        // Blit rasterized pixels to a temporary buffer and keep a pointer to it.
+        const int bitmap_size_in_bytes = src_glyph.Info.Width * src_glyph.Info.Height * 4;
+        if (bitmap_size_in_bytes > 0)
+        {
+            src_glyph.BitmapData = (unsigned int*)GImGuiFreeTypeAllocFunc((size_t)bitmap_size_in_bytes, GImGuiFreeTypeAllocatorUserData);
+            src_tmp.Font.BlitGlyph(ft_bitmap, src_glyph.BitmapData, src_glyph.Info.Width, multiply_enabled ? multiply_table : nullptr);
+        }
+
+        src_tmp.Rects[glyph_i].w = (stbrp_coord)(src_glyph.Info.Width + padding);
+        src_tmp.Rects[glyph_i].h = (stbrp_coord)(src_glyph.Info.Height + padding);
+    }
+}
+
+static void ImFontAtlasBuildParallelForFT(ImFontAtlas* atlas, void (*job_func)(void* job_data, int job_index), void* job_data, int job_count)
+{
+#ifdef IMGUI_ENABLE_FREETYPE_LUNASVG
+    // The SVG renderer hooks state is shared by all faces of the library: stay on the calling thread.
+    IM_UNUSED(atlas);
+    for (int job_index = 0; job_index < job_count; job_index++)
+        job_func(job_data, job_index);
+#else
+    ImFontAtlasBuildParallelFor(atlas, job_func, job_data, job_count);
+#endif
+}
+
+// Data kept alive after building with ImFontAtlasFlags_DynamicGlyphs, stored in atlas->FontBuilderData
+struct ImFontBuilderDataFT
+{
+    FT_MemoryRec_           MemoryRec;      // Referenced by Library
+    FT_Library              Library;
+    ImVector<FreeTypeFont>  Fonts;          // Opened faces, indexed like atlas->ConfigData[]
+
+    ImFontBuilderDataFT()   { memset((void*)&MemoryRec, 0, sizeof(MemoryRec)); Library = nullptr; }
+};
+
+bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, unsigned int extra_flags, ImFontBuilderDataFT* dynamic_data)
 {
     IM_ASSERT(atlas->ConfigData.Size > 0);
 
@@ -434,6 +519,7 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
     atlas->TexUvScale = ImVec2(0.0f, 0.0f);
     atlas->TexUvWhitePixel = ImVec2(0.0f, 0.0f);
     atlas->ClearTexData();
+    atlas->TexExtraPages.clear();
 
     // Temporary storage for building
     bool src_load_color = false;
@@ -481,7 +567,12 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
     }
 
     // 2. For every requested codepoint, check for their presence in the font data, and handle redundancy or overlaps between source fonts to avoid unused glyphs.
-    int total_glyphs_count = 0;
+    // (With ImFontAtlasFlags_DynamicGlyphs, codepoints above IM_FONTATLAS_DYNAMIC_GLYPHS_PRELOAD_MAX are rasterized on demand by ImFontAtlasBuildGlyphWithFreeType())
+    // Lookups run as one job per source font, then sources are merged in order so the result doesn't depend on job scheduling.
+    ImFontBuildJobsDataFT jobs_data;
+    jobs_data.Atlas = atlas;
+    jobs_data.SrcTmpArray = src_tmp_array.Data;
+    jobs_data.CodepointMax = (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs) ? IM_FONTATLAS_DYNAMIC_GLYPHS_PRELOAD_MAX : IM_UNICODE_CODEPOINT_MAX;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcDataFT& src_tmp = src_tmp_array[src_i];
@@ -489,23 +580,27 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
         src_tmp.GlyphsSet.Create(src_tmp.GlyphsHighest + 1);
         if (dst_tmp.GlyphsSet.Storage.empty())
             dst_tmp.GlyphsSet.Create(dst_tmp.GlyphsHighest + 1);
+    }
+    ImFontAtlasBuildParallelForFT(atlas, ImFontAtlasBuildJobFindGlyphsFT, &jobs_data, src_tmp_array.Size);
 
-        for (const ImWchar* src_range = src_tmp.SrcRanges; src_range[0] && src_range[1]; src_range += 2)
-            for (int codepoint = src_range[0]; codepoint <= (int)src_range[1]; codepoint++)
-            {
-                if (dst_tmp.GlyphsSet.TestBit(codepoint))    // Don't overwrite existing glyphs. We could make this an option (e.g. MergeOverwrite)
-                    continue;
-                uint32_t glyph_index = FT_Get_Char_Index(src_tmp.Font.Face, codepoint); // It is actually in the font? (FIXME-OPT: We are not storing the glyph_index..)
-                if (glyph_index == 0)
-                    continue;
-
-                // Add to avail set/counters
+    int total_glyphs_count = 0;
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+    {
+        // Don't overwrite existing glyphs. We could make this an option (e.g. MergeOverwrite)
+        ImFontBuildSrcDataFT& src_tmp = src_tmp_array[src_i];
+        ImFontBuildDstDataFT& dst_tmp = dst_tmp_array[src_tmp.DstIndex];
+        ImU32* src_bits = src_tmp.GlyphsSet.Storage.Data;
+        ImU32* dst_bits = dst_tmp.GlyphsSet.Storage.Data;
+        for (int n = 0; n < src_tmp.GlyphsSet.Storage.Size; n++)
+        {
+            ImU32 bits = src_bits[n] & ~dst_bits[n];
+            src_bits[n] = bits;
+            dst_bits[n] |= bits;
+            for (; bits != 0; bits &= bits - 1)
                 src_tmp.GlyphsCount++;
-                dst_tmp.GlyphsCount++;
-                src_tmp.GlyphsSet.SetBit(codepoint);
-                dst_tmp.GlyphsSet.SetBit(codepoint);
-                total_glyphs_count++;
-            }
+        }
+        dst_tmp.GlyphsCount += src_tmp.GlyphsCount;
+        total_glyphs_count += src_tmp.GlyphsCount;
     }
 
     // 3. Unpack our bit map into a flat list (we now have all the Unicode points that we know are requested _and_ available _and_ not overlapping another)
@@ -535,74 +630,30 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
     dst_tmp_array.clear();
 
     // Allocate packing character data and flag packed characters buffer as non-packed (x0=y0=x1=y1=0)
-    // (We technically don't need to zero-clear buf_rects, but let's do it for the sake of sanity)
+    // (Zero-clear buf_rects: stbrp_rect::id stores the texture page, see ImFontAtlasBuildPackExtraPages())
     ImVector<stbrp_rect> buf_rects;
     buf_rects.resize(total_glyphs_count);
-    memset(buf_rects.Data, 0, (size_t)buf_rects.size_in_bytes());
-
-    // Allocate temporary rasterization data buffers.
-    // We could not find a way to retrieve accurate glyph size without rendering them.
-    // (e.g. slot->metrics->width not always matching bitmap->width, especially considering the Oblique transform)
-    // We allocate in chunks of 256 KB to not waste too much extra memory ahead. Hopefully users of FreeType won't mind the temporary allocations.
-    const int BITMAP_BUFFERS_CHUNK_SIZE = 256 * 1024;
-    int buf_bitmap_current_used_bytes = 0;
-    ImVector<unsigned char*> buf_bitmap_buffers;
-    buf_bitmap_buffers.push_back((unsigned char*)IM_ALLOC(BITMAP_BUFFERS_CHUNK_SIZE));
+    if (total_glyphs_count > 0) // May be zero when all fonts are ImFontConfig::Deferred
+        memset(buf_rects.Data, 0, (size_t)buf_rects.size_in_bytes());
 
     // 4. Gather glyphs sizes so we can pack them in our virtual canvas.
     // 8. Render/rasterize font characters into the texture
-    int total_surface = 0;
+    // We could not find a way to retrieve accurate glyph size without rendering them.
+    // (e.g. slot->metrics->width not always matching bitmap->width, especially considering the Oblique transform)
+    // Glyphs are rasterized into temporary buffers, one job per source font. Hopefully users of FreeType won't mind the temporary allocations.
     int buf_rects_out_n = 0;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcDataFT& src_tmp = src_tmp_array[src_i];
-        ImFontConfig& cfg = atlas->ConfigData[src_i];
         if (src_tmp.GlyphsCount == 0)
             continue;
-
         src_tmp.Rects = &buf_rects[buf_rects_out_n];
         buf_rects_out_n += src_tmp.GlyphsCount;
-
-        // Compute multiply table if requested
-        const bool multiply_enabled = (cfg.RasterizerMultiply != 1.0f);
-        unsigned char multiply_table[256];
-        if (multiply_enabled)
-            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
-
-        // Gather the sizes of all rectangles we will need to pack
-        const int padding = atlas->TexGlyphPadding;
-        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsList.Size; glyph_i++)
-        {
-            ImFontBuildSrcGlyphFT& src_glyph = src_tmp.GlyphsList[glyph_i];
-
-            const FT_Glyph_Metrics* metrics = src_tmp.Font.LoadGlyph(src_glyph.Codepoint);
-            if (metrics == nullptr)
-                continue;
-
-            // Render glyph into a bitmap (currently held by FreeType)
-            const FT_Bitmap* ft_bitmap = src_tmp.Font.RenderGlyphAndGetInfo(&src_glyph.Info);
-            if (ft_bitmap == nullptr)
-                continue;
-
-            // Allocate new temporary chunk if needed
-            const int bitmap_size_in_bytes = src_glyph.Info.Width * src_glyph.Info.Height * 4;
-            if (buf_bitmap_current_used_bytes + bitmap_size_in_bytes > BITMAP_BUFFERS_CHUNK_SIZE)
-            {
-                buf_bitmap_current_used_bytes = 0;
-                buf_bitmap_buffers.push_back((unsigned char*)IM_ALLOC(BITMAP_BUFFERS_CHUNK_SIZE));
-            }
-            IM_ASSERT(buf_bitmap_current_used_bytes + bitmap_size_in_bytes <= BITMAP_BUFFERS_CHUNK_SIZE); // We could probably allocate custom-sized buffer instead.
-
-            // Blit rasterized pixels to our temporary buffer and keep a pointer to it.
-            src_glyph.BitmapData = (unsigned int*)(buf_bitmap_buffers.back() + buf_bitmap_current_used_bytes);
-            buf_bitmap_current_used_bytes += bitmap_size_in_bytes;
-            src_tmp.Font.BlitGlyph(ft_bitmap, src_glyph.BitmapData, src_glyph.Info.Width, multiply_enabled ? multiply_table : nullptr);
-
-            src_tmp.Rects[glyph_i].w = (stbrp_coord)(src_glyph.Info.Width + padding);
-            src_tmp.Rects[glyph_i].h = (stbrp_coord)(src_glyph.Info.Height + padding);
-            total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
-        }
     }
+    ImFontAtlasBuildParallelForFT(atlas, ImFontAtlasBuildJobRenderGlyphsFT, &jobs_data, src_tmp_array.Size);
+    int total_surface = 0;
+    for (int rect_i = 0; rect_i < buf_rects.Size; rect_i++)
+        total_surface += buf_rects[rect_i].w * buf_rects[rect_i].h;
 
     // We need a width for the skyline algorithm, any width!
     // The exact width doesn't really matter much, but some API/GPU have texture size limitations and increasing width can decrease height.
@@ -612,17 +663,13 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
     if (atlas->TexDesiredWidth > 0)
         atlas->TexWidth = atlas->TexDesiredWidth;
     else
-        atlas->TexWidth = (surface_sqrt >= 4096 * 0.7f) ? 4096 : (surface_sqrt >= 2048 * 0.7f) ? 2048 : (surface_sqrt >= 1024 * 0.7f) ? 1024 : 512;
+        atlas->TexWidth = (surface_sqrt >= 4096 * 0.7f) ? 4096 : (surface_sqrt >= 2048 * 0.7f) ? 2048 : (surface_sqrt >= 1024 * 0.7f || (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs)) ? 1024 : 512;
 
     // 5. Start packing
     // Pack our extra data rectangles first, so it will be on the upper-left corner of our texture (UV will have small values).
     const int TEX_HEIGHT_MAX = 1024 * 32;
-    const int num_nodes_for_packing_algorithm = atlas->TexWidth - atlas->TexGlyphPadding;
-    ImVector<stbrp_node> pack_nodes;
-    pack_nodes.resize(num_nodes_for_packing_algorithm);
-    stbrp_context pack_context;
-    stbrp_init_target(&pack_context, atlas->TexWidth - atlas->TexGlyphPadding, TEX_HEIGHT_MAX - atlas->TexGlyphPadding, pack_nodes.Data, pack_nodes.Size);
-    ImFontAtlasBuildPackCustomRects(atlas, &pack_context);
+    ImFontAtlasRectPacker* packer = ImFontAtlasBuildPackBegin(atlas, atlas->TexWidth - atlas->TexGlyphPadding, ((atlas->TexMaxHeight > 0) ? atlas->TexMaxHeight : TEX_HEIGHT_MAX) - atlas->TexGlyphPadding);
+    ImFontAtlasBuildPackCustomRects(atlas, packer);
 
     // 6. Pack each source font. No rendering yet, we are working with rectangles in an infinitely tall texture at this point.
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
@@ -631,17 +678,28 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
         if (src_tmp.GlyphsCount == 0)
             continue;
 
-        stbrp_pack_rects(&pack_context, src_tmp.Rects, src_tmp.GlyphsCount);
+        // With ImFontAtlasFlags_PackShelves, pack following sources in the same call (their rectangles are contiguous in buf_rects):
+        // the shelf packer wastes less space when it sees rectangles of all heights at once.
+        int rects_count = src_tmp.GlyphsCount;
+        while ((atlas->Flags & ImFontAtlasFlags_PackShelves) && src_i + 1 < src_tmp_array.Size)
+            rects_count += src_tmp_array[++src_i].GlyphsCount;
+        ImFontAtlasBuildPackRects(packer, src_tmp.Rects, rects_count);
 
         // Extend texture height and mark missing glyphs as non-packed so we won't render them.
         // FIXME: We are not handling packing failure here (would happen if we got off TEX_HEIGHT_MAX or if a single if larger than TexWidth?)
-        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++)
+        for (int glyph_i = 0; glyph_i < rects_count; glyph_i++)
             if (src_tmp.Rects[glyph_i].was_packed)
                 atlas->TexHeight = ImMax(atlas->TexHeight, src_tmp.Rects[glyph_i].y + src_tmp.Rects[glyph_i].h);
     }
+    ImFontAtlasBuildPackEnd(packer);
+    const int tex_pages_count = ImFontAtlasBuildPackExtraPages(atlas, buf_rects.Data, buf_rects.Size);
 
     // 7. Allocate texture
+    if (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs)
+        ImFontAtlasBuildReserveDynamicSpace(atlas);
     atlas->TexHeight = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (atlas->TexHeight + 1) : ImUpperPowerOfTwo(atlas->TexHeight);
+    if (atlas->TexMaxHeight > 0)
+        atlas->TexHeight = (tex_pages_count > 1) ? atlas->TexMaxHeight : ImMin(atlas->TexHeight, atlas->TexMaxHeight); // All pages have the same size
     atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
     if (src_load_color)
     {
@@ -655,6 +713,7 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
         atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(tex_size);
         memset(atlas->TexPixelsAlpha8, 0, tex_size);
     }
+    ImFontAtlasBuildAllocExtraPages(atlas);
 
     // 8. Copy rasterized font characters back into the main texture
     // 9. Setup ImFont and glyphs for runtime
@@ -662,18 +721,19 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcDataFT& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
-            continue;
 
         // When merging fonts with MergeMode=true:
         // - We can have multiple input fonts writing into a same destination font.
         // - dst_font->ConfigData is != from cfg which is our source configuration.
+        // Fonts are setup even without glyphs (ImFontConfig::Deferred), like the stb_truetype builder does.
         ImFontConfig& cfg = atlas->ConfigData[src_i];
         ImFont* dst_font = cfg.DstFont;
 
         const float ascent = src_tmp.Font.Info.Ascender;
         const float descent = src_tmp.Font.Info.Descender;
         ImFontAtlasBuildSetupFont(atlas, dst_font, &cfg, ascent, descent);
+        if (src_tmp.GlyphsCount == 0)
+            continue;
         const float font_off_x = cfg.GlyphOffset.x;
         const float font_off_y = cfg.GlyphOffset.y + IM_ROUND(dst_font->Ascent);
 
@@ -707,21 +767,24 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
             IM_ASSERT(dst_glyph->Codepoint == src_glyph.Codepoint);
             if (src_glyph.Info.IsColored)
                 dst_glyph->Colored = tex_use_colors = true;
+            dst_glyph->TexPage = (unsigned int)pack_rect.id;
 
             // Blit from temporary buffer to final texture
             size_t blit_src_stride = (size_t)src_glyph.Info.Width;
             size_t blit_dst_stride = (size_t)atlas->TexWidth;
             unsigned int* blit_src = src_glyph.BitmapData;
-            if (atlas->TexPixelsAlpha8 != nullptr)
+            unsigned char* page_pixels_alpha8 = (pack_rect.id == 0) ? atlas->TexPixelsAlpha8 : atlas->TexExtraPages[pack_rect.id - 1].PixelsAlpha8;
+            unsigned int* page_pixels_rgba32 = (pack_rect.id == 0) ? atlas->TexPixelsRGBA32 : atlas->TexExtraPages[pack_rect.id - 1].PixelsRGBA32;
+            if (page_pixels_alpha8 != nullptr)
             {
-                unsigned char* blit_dst = atlas->TexPixelsAlpha8 + (ty * blit_dst_stride) + tx;
+                unsigned char* blit_dst = page_pixels_alpha8 + (ty * blit_dst_stride) + tx;
                 for (int y = 0; y < info.Height; y++, blit_dst += blit_dst_stride, blit_src += blit_src_stride)
                     for (int x = 0; x < info.Width; x++)
                         blit_dst[x] = (unsigned char)((blit_src[x] >> IM_COL32_A_SHIFT) & 0xFF);
             }
             else
             {
-                unsigned int* blit_dst = atlas->TexPixelsRGBA32 + (ty * blit_dst_stride) + tx;
+                unsigned int* blit_dst = page_pixels_rgba32 + (ty * blit_dst_stride) + tx;
                 for (int y = 0; y < info.Height; y++, blit_dst += blit_dst_stride, blit_src += blit_src_stride)
                     for (int x = 0; x < info.Width; x++)
                         blit_dst[x] = blit_src[x];
@@ -732,9 +795,23 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
     }
     atlas->TexPixelsUseColors = tex_use_colors;
 
+    // Keep faces opened to rasterize remaining glyphs on demand
+    if (dynamic_data != nullptr)
+    {
+        dynamic_data->Fonts.resize(src_tmp_array.Size);
+        for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        {
+            dynamic_data->Fonts[src_i] = src_tmp_array[src_i].Font;
+            src_tmp_array[src_i].Font.Face = nullptr;
+        }
+        atlas->FontBuilderData = dynamic_data;
+    }
+
     // Cleanup
-    for (int buf_i = 0; buf_i < buf_bitmap_buffers.Size; buf_i++)
-        IM_FREE(buf_bitmap_buffers[buf_i]);
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        for (int glyph_i = 0; glyph_i < src_tmp_array[src_i].GlyphsList.Size; glyph_i++)
+            if (src_tmp_array[src_i].GlyphsList[glyph_i].BitmapData != nullptr)
+                GImGuiFreeTypeFreeFunc(src_tmp_array[src_i].GlyphsList[glyph_i].BitmapData, GImGuiFreeTypeAllocatorUserData);
     src_tmp_array.clear_destruct();
 
     ImFontAtlasBuildFinish(atlas);
@@ -778,8 +855,11 @@ static void* FreeType_Realloc(FT_Memory /*memory*/, long cur_size, long new_size
 
 static bool ImFontAtlasBuildWithFreeType(ImFontAtlas* atlas)
 {
+    // With ImFontAtlasFlags_DynamicGlyphs the library and faces outlive this function, so the memory record needs to be persistent too.
+    ImFontBuilderDataFT* bd = IM_NEW(ImFontBuilderDataFT)();
+
     // FreeType memory management: https://www.freetype.org/freetype2/docs/design/design-4.html
-    FT_MemoryRec_ memory_rec = {};
+    FT_MemoryRec_& memory_rec = bd->MemoryRec;
     memory_rec.user = nullptr;
     memory_rec.alloc = &FreeType_Alloc;
     memory_rec.free = &FreeType_Free;
@@ -789,7 +869,11 @@ static bool ImFontAtlasBuildWithFreeType(ImFontAtlas* atlas)
     FT_Library ft_library;
     FT_Error error = FT_New_Library(&memory_rec, &ft_library);
     if (error != 0)
+    {
+        IM_DELETE(bd);
         return false;
+    }
+    bd->Library = ft_library;
 
     // If you don't call FT_Add_Default_Modules() the rest of code may work, but FreeType won't use our custom allocator.
     FT_Add_Default_Modules(ft_library);
@@ -802,16 +886,104 @@ static bool ImFontAtlasBuildWithFreeType(ImFontAtlas* atlas)
     FT_Property_Set(ft_library, "ot-svg", "svg-hooks", &hooks);
 #endif // IMGUI_ENABLE_FREETYPE_LUNASVG
 
-    bool ret = ImFontAtlasBuildWithFreeTypeEx(ft_library, atlas, atlas->FontBuilderFlags);
-    FT_Done_Library(ft_library);
+    bool ret = ImFontAtlasBuildWithFreeTypeEx(ft_library, atlas, atlas->FontBuilderFlags, (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs) ? bd : nullptr);
+    if (atlas->FontBuilderData != bd)
+    {
+        FT_Done_Library(ft_library);
+        IM_DELETE(bd);
+    }
 
     return ret;
 }
 
+// Rasterize a single glyph into the free space reserved by ImFontAtlasBuildWithFreeTypeEx() (ImFontAtlasFlags_DynamicGlyphs)
+static bool ImFontAtlasBuildGlyphWithFreeType(ImFontAtlas* atlas, ImFontConfig* src_cfg, ImWchar codepoint)
+{
+    ImFontBuilderDataFT* bd = (ImFontBuilderDataFT*)atlas->FontBuilderData;
+    const int src_i = (int)(src_cfg - atlas->ConfigData.Data);
+    IM_ASSERT(src_i >= 0 && src_i < bd->Fonts.Size);
+    FreeTypeFont& font_face = bd->Fonts[src_i];
+    if (font_face.Face == nullptr || font_face.LoadGlyph(codepoint) == nullptr)
+        return false;
+    GlyphInfo info;
+    const FT_Bitmap* ft_bitmap = font_face.RenderGlyphAndGetInfo(&info);
+    if (ft_bitmap == nullptr)
+        return false;
+
+    // Pack (blank glyphs don't need any texture space)
+    const ImFontConfig& cfg = *src_cfg;
+    const int padding = atlas->TexGlyphPadding;
+    int tx = 0, ty = 0;
+    if (info.Width > 0 && info.Height > 0)
+    {
+        if (!ImFontAtlasBuildAllocDynamicRect(atlas, info.Width + padding, info.Height + padding, &tx, &ty))
+            return false;
+        tx += padding;
+        ty += padding;
+
+        // Rasterize into a temporary buffer
+        const bool multiply_enabled = (cfg.RasterizerMultiply != 1.0f);
+        unsigned char multiply_table[256];
+        if (multiply_enabled)
+            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        ImVector<unsigned int> bitmap_data;
+        bitmap_data.resize(info.Width * info.Height);
+        font_face.BlitGlyph(ft_bitmap, bitmap_data.Data, info.Width, multiply_enabled ? multiply_table : nullptr);
+
+        // Blit from temporary buffer to texture
+        size_t blit_src_stride = (size_t)info.Width;
+        size_t blit_dst_stride = (size_t)atlas->TexWidth;
+        unsigned int* blit_src = bitmap_data.Data;
+        if (atlas->TexPixelsAlpha8 != nullptr)
+        {
+            unsigned char* blit_dst = atlas->TexPixelsAlpha8 + (ty * blit_dst_stride) + tx;
+            for (int y = 0; y < info.Height; y++, blit_dst += blit_dst_stride, blit_src += blit_src_stride)
+                for (int x = 0; x < info.Width; x++)
+                    blit_dst[x] = (unsigned char)((blit_src[x] >> IM_COL32_A_SHIFT) & 0xFF);
+        }
+        else
+        {
+            unsigned int* blit_dst = atlas->TexPixelsRGBA32 + (ty * blit_dst_stride) + tx;
+            for (int y = 0; y < info.Height; y++, blit_dst += blit_dst_stride, blit_src += blit_src_stride)
+                for (int x = 0; x < info.Width; x++)
+                    blit_dst[x] = blit_src[x];
+        }
+        ImFontAtlasBuildUpdateTexRect(atlas, tx, ty, info.Width, info.Height);
+    }
+
+    // Register glyph
+    ImFont* dst_font = cfg.DstFont;
+    const float font_off_x = cfg.GlyphOffset.x;
+    const float font_off_y = cfg.GlyphOffset.y + IM_ROUND(dst_font->Ascent);
+    float x0 = info.OffsetX + font_off_x;
+    float y0 = info.OffsetY + font_off_y;
+    float x1 = x0 + info.Width;
+    float y1 = y0 + info.Height;
+    float u0 = (tx) / (float)atlas->TexWidth;
+    float v0 = (ty) / (float)atlas->TexHeight;
+    float u1 = (tx + info.Width) / (float)atlas->TexWidth;
+    float v1 = (ty + info.Height) / (float)atlas->TexHeight;
+    dst_font->AddGlyph(&cfg, codepoint, x0, y0, x1, y1, u0, v0, u1, v1, info.AdvanceX);
+    if (info.IsColored)
+        dst_font->Glyphs.back().Colored = atlas->TexPixelsUseColors = true;
+    return true;
+}
+
+static void ImFontAtlasBuildDestroyFreeType(ImFontAtlas* atlas)
+{
+    ImFontBuilderDataFT* bd = (ImFontBuilderDataFT*)atlas->FontBuilderData;
+    for (int src_i = 0; src_i < bd->Fonts.Size; src_i++)
+        bd->Fonts[src_i].CloseFont();
+    FT_Done_Library(bd->Library);
+    IM_DELETE(bd);
+}
+
 const ImFontBuilderIO* ImGuiFreeType::GetBuilderForFreeType()
 {
     static ImFontBuilderIO io;
     io.FontBuilder_Build = ImFontAtlasBuildWithFreeType;
+    io.FontBuilder_BuildGlyph = ImFontAtlasBuildGlyphWithFreeType;
+    io.FontBuilder_Destroy = ImFontAtlasBuildDestroyFreeType;
     return &io;
 }
 